@@ -0,0 +1,449 @@
+//compares static_vector with std::vector and boost::container::static_vector, and static_map
+//with std::unordered_map and std::map, over a range of capacities and element types, and
+//static_soa_vector with a static_vector of the same records for loops over one field. each
+//measurement works on enough containers to touch about the same number of elements whatever
+//the capacity. ns_per_op is per element for the vector operations and per key for the map
+//operations. pass --json for json output instead of csv
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <stc/static_map.hpp>
+#include <stc/static_soa_vector.hpp>
+#include <stc/static_vector.hpp>
+#if defined(STC_BENCH_BOOST)
+#include <boost/container/static_vector.hpp>
+#endif
+#include "harness.hpp"
+
+namespace
+{
+    constexpr size_t elements_per_run = 1 << 16;
+    //middle insertions and erasures per container, so large capacities stay affordable
+    constexpr size_t max_shifts = 64;
+
+    struct pod64
+    {
+        uint64_t values[8];
+    };
+
+    static_assert(sizeof(pod64) == 64);
+
+    template <typename T>
+    T make_element(size_t i);
+
+    template <>
+    int make_element<int>(size_t i)
+    {
+        return static_cast<int>(i);
+    }
+
+    template <>
+    pod64 make_element<pod64>(size_t i)
+    {
+        pod64 pod = {};
+        pod.values[0] = i;
+        return pod;
+    }
+
+    //long enough to live on the heap
+    template <>
+    std::string make_element<std::string>(size_t i)
+    {
+        return "a string too long for sso " + std::to_string(i);
+    }
+
+    uint64_t weight(int value)
+    {
+        return static_cast<uint64_t>(value);
+    }
+
+    uint64_t weight(const pod64& value)
+    {
+        return value.values[0];
+    }
+
+    uint64_t weight(const std::string& value)
+    {
+        return value.size() + static_cast<uint64_t>(value.back());
+    }
+
+    template <typename T>
+    const char* element_name();
+
+    template <>
+    const char* element_name<int>()
+    {
+        return "int";
+    }
+
+    template <>
+    const char* element_name<pod64>()
+    {
+        return "pod64";
+    }
+
+    template <>
+    const char* element_name<std::string>()
+    {
+        return "string";
+    }
+
+    //the standard containers get room for every element up front, like the static ones have
+    template <typename T, typename = void>
+    struct has_reserve: std::false_type {};
+
+    template <typename T>
+    struct has_reserve<T, std::void_t<decltype(std::declval<T&>().reserve(size_t()))>>: std::true_type {};
+
+    template <typename vector_type, size_t capacity>
+    void vector_benchmarks(bench::runner& runner, const char* container)
+    {
+        using element_type = typename vector_type::value_type;
+
+        const char* element = element_name<element_type>();
+        const size_t count = std::max<size_t>(elements_per_run / capacity, 1);
+        const size_t shifts = std::min(capacity / 2, max_shifts);
+
+        std::vector<element_type> source;
+        for(size_t i = 0; i < capacity; ++i)
+            source.push_back(make_element<element_type>(i));
+
+        std::vector<vector_type> vectors(count);
+        std::vector<vector_type> targets(count);
+
+        auto refill = [&] (vector_type& vector, size_t size)
+        {
+            vector.clear();
+
+            if constexpr(has_reserve<vector_type>::value)
+                vector.reserve(capacity);
+
+            vector.insert(vector.end(), source.begin(), source.begin() + size);
+        };
+
+        runner.run(container, "push_back", element, capacity, count * capacity, [&] (bench::timer& timer)
+        {
+            for(vector_type& vector : vectors)
+                refill(vector, 0);
+
+            timer.start();
+            for(vector_type& vector : vectors)
+            {
+                for(const element_type& value : source)
+                    vector.push_back(value);
+            }
+            timer.stop();
+
+            bench::do_not_optimize(vectors.back().back());
+        });
+
+        runner.run(container, "insert_middle", element, capacity, count * shifts, [&] (bench::timer& timer)
+        {
+            for(vector_type& vector : vectors)
+                refill(vector, capacity - shifts);
+
+            timer.start();
+            for(vector_type& vector : vectors)
+            {
+                for(size_t i = 0; i < shifts; ++i)
+                    vector.insert(vector.begin() + vector.size() / 2, source[i]);
+            }
+            timer.stop();
+
+            bench::do_not_optimize(vectors.back().back());
+        });
+
+        runner.run(container, "erase_middle", element, capacity, count * shifts, [&] (bench::timer& timer)
+        {
+            for(vector_type& vector : vectors)
+                refill(vector, capacity);
+
+            timer.start();
+            for(vector_type& vector : vectors)
+            {
+                for(size_t i = 0; i < shifts; ++i)
+                    vector.erase(vector.begin() + vector.size() / 2);
+            }
+            timer.stop();
+
+            bench::do_not_optimize(vectors.back().back());
+        });
+
+        for(vector_type& vector : vectors)
+            refill(vector, capacity);
+
+        runner.run(container, "iterate", element, capacity, count * capacity, [&] (bench::timer& timer)
+        {
+            uint64_t sum = 0;
+
+            timer.start();
+            for(const vector_type& vector : vectors)
+            {
+                for(const element_type& value : vector)
+                    sum += weight(value);
+            }
+            timer.stop();
+
+            bench::do_not_optimize(sum);
+        });
+
+        runner.run(container, "copy", element, capacity, count * capacity, [&] (bench::timer& timer)
+        {
+            for(vector_type& target : targets)
+                refill(target, 0);
+
+            timer.start();
+            for(size_t i = 0; i < count; ++i)
+                targets[i] = vectors[i];
+            timer.stop();
+
+            bench::do_not_optimize(targets.back().back());
+        });
+
+        runner.run(container, "move", element, capacity, count * capacity, [&] (bench::timer& timer)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                refill(vectors[i], capacity);
+                refill(targets[i], 0);
+            }
+
+            timer.start();
+            for(size_t i = 0; i < count; ++i)
+                targets[i] = std::move(vectors[i]);
+            timer.stop();
+
+            bench::do_not_optimize(targets.back().back());
+        });
+    }
+
+    template <typename element_type, size_t capacity>
+    void vector_benchmarks(bench::runner& runner)
+    {
+        vector_benchmarks<stc::static_vector<element_type, capacity>, capacity>(runner, "stc::static_vector");
+        vector_benchmarks<std::vector<element_type>, capacity>(runner, "std::vector");
+#if defined(STC_BENCH_BOOST)
+        vector_benchmarks<boost::container::static_vector<element_type, capacity>, capacity>(runner, "boost::static_vector");
+#endif
+    }
+
+    template <typename map_type, size_t capacity>
+    void map_benchmarks(bench::runner& runner, const char* container)
+    {
+        using key_type = typename map_type::key_type;
+        using mapped_type = typename map_type::mapped_type;
+
+        const char* element = element_name<mapped_type>();
+        const size_t count = std::max<size_t>(elements_per_run / capacity, 1);
+        //open addressing needs some headroom, so every map is filled to three quarters
+        const size_t size = capacity * 3 / 4;
+
+        std::vector<key_type> keys;
+        std::vector<key_type> absent_keys;
+        for(size_t i = 0; i < size; ++i)
+        {
+            keys.push_back(make_element<key_type>(i));
+            absent_keys.push_back(make_element<key_type>(size + i));
+        }
+
+        std::vector<key_type> shuffled = keys;
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(static_cast<uint32_t>(capacity)));
+
+        const mapped_type value = make_element<mapped_type>(1);
+        std::vector<map_type> maps(count);
+
+        auto refill = [&] (map_type& map)
+        {
+            map.clear();
+
+            if constexpr(has_reserve<map_type>::value)
+                map.reserve(capacity);
+
+            for(const key_type& key : keys)
+                map.insert({key, value});
+        };
+
+        runner.run(container, "insert", element, capacity, count * size, [&] (bench::timer& timer)
+        {
+            for(map_type& map : maps)
+            {
+                map.clear();
+
+                if constexpr(has_reserve<map_type>::value)
+                    map.reserve(capacity);
+            }
+
+            timer.start();
+            for(map_type& map : maps)
+            {
+                for(const key_type& key : shuffled)
+                    map.insert({key, value});
+            }
+            timer.stop();
+
+            bench::do_not_optimize(maps.back().size());
+        });
+
+        for(map_type& map : maps)
+            refill(map);
+
+        runner.run(container, "find_hit", element, capacity, count * size, [&] (bench::timer& timer)
+        {
+            uint64_t sum = 0;
+
+            timer.start();
+            for(const map_type& map : maps)
+            {
+                for(const key_type& key : shuffled)
+                    sum += weight(map.find(key)->second);
+            }
+            timer.stop();
+
+            bench::do_not_optimize(sum);
+        });
+
+        runner.run(container, "find_miss", element, capacity, count * size, [&] (bench::timer& timer)
+        {
+            uint64_t misses = 0;
+
+            timer.start();
+            for(const map_type& map : maps)
+            {
+                for(const key_type& key : absent_keys)
+                    misses += map.find(key) == map.end();
+            }
+            timer.stop();
+
+            bench::do_not_optimize(misses);
+        });
+
+        runner.run(container, "erase", element, capacity, count * size, [&] (bench::timer& timer)
+        {
+            for(map_type& map : maps)
+                refill(map);
+
+            timer.start();
+            for(map_type& map : maps)
+            {
+                for(const key_type& key : shuffled)
+                    map.erase(key);
+            }
+            timer.stop();
+
+            bench::do_not_optimize(maps.back().size());
+        });
+    }
+
+    //string values come with string keys, the other values with int keys
+    template <typename mapped_type, size_t capacity>
+    void map_benchmarks(bench::runner& runner)
+    {
+        using key_type = std::conditional_t<std::is_same_v<mapped_type, std::string>, std::string, int>;
+
+        map_benchmarks<stc::static_map<key_type, mapped_type, capacity>, capacity>(runner, "stc::static_map");
+        map_benchmarks<stc::static_map<key_type, mapped_type, capacity, std::hash<key_type>, std::equal_to<key_type>, stc::group_probing>, capacity>(runner, "stc::static_map<group_probing>");
+        map_benchmarks<stc::static_map<key_type, mapped_type, capacity, std::hash<key_type>, std::equal_to<key_type>, stc::linear_probing, stc::no_stats, stc::split_layout>, capacity>(runner, "stc::static_map<split_layout>");
+
+        if constexpr(std::is_integral_v<key_type> && capacity <= 64)
+            map_benchmarks<stc::static_map<key_type, mapped_type, capacity, std::hash<key_type>, std::equal_to<key_type>, stc::scan_probing>, capacity>(runner, "stc::static_map<scan_probing>");
+
+        map_benchmarks<std::unordered_map<key_type, mapped_type>, capacity>(runner, "std::unordered_map");
+        map_benchmarks<std::map<key_type, mapped_type>, capacity>(runner, "std::map");
+    }
+
+    //records of which a hot loop only reads and writes a few fields
+    struct particle
+    {
+        float x;
+        float y;
+        float z;
+        float velocity_x;
+        float velocity_y;
+        float velocity_z;
+        float mass;
+        uint32_t id;
+    };
+
+    template <size_t capacity>
+    void field_benchmarks(bench::runner& runner)
+    {
+        using soa_type = stc::static_soa_vector<capacity, float, float, float, float, float, float, float, uint32_t>;
+        using aos_type = stc::static_vector<particle, capacity>;
+
+        const size_t count = std::max<size_t>(elements_per_run / capacity, 1);
+
+        std::vector<soa_type> soas(count);
+        std::vector<aos_type> aoses(count);
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            for(size_t j = 0; j < capacity; ++j)
+            {
+                float value = static_cast<float>(j);
+                soas[i].emplace_back(value, value, value, 1.0f, 2.0f, 3.0f, 1.0f, static_cast<uint32_t>(j));
+                aoses[i].push_back(particle{value, value, value, 1.0f, 2.0f, 3.0f, 1.0f, static_cast<uint32_t>(j)});
+            }
+        }
+
+        runner.run("stc::static_soa_vector", "update_field", "particle", capacity, count * capacity, [&] (bench::timer& timer)
+        {
+            timer.start();
+            for(soa_type& soa : soas)
+            {
+                float* x = soa.template data<0>();
+                const float* velocity_x = soa.template data<3>();
+
+                for(size_t i = 0; i < soa.size(); ++i)
+                    x[i] += velocity_x[i];
+            }
+            timer.stop();
+
+            bench::do_not_optimize(soas.back().template data<0>()[0]);
+        });
+
+        runner.run("stc::static_vector", "update_field", "particle", capacity, count * capacity, [&] (bench::timer& timer)
+        {
+            timer.start();
+            for(aos_type& aos : aoses)
+            {
+                for(particle& entry : aos)
+                    entry.x += entry.velocity_x;
+            }
+            timer.stop();
+
+            bench::do_not_optimize(aoses.back()[0].x);
+        });
+    }
+
+    template <size_t capacity>
+    void all_benchmarks(bench::runner& runner)
+    {
+        vector_benchmarks<int, capacity>(runner);
+        vector_benchmarks<pod64, capacity>(runner);
+        vector_benchmarks<std::string, capacity>(runner);
+
+        map_benchmarks<int, capacity>(runner);
+        map_benchmarks<pod64, capacity>(runner);
+        map_benchmarks<std::string, capacity>(runner);
+
+        field_benchmarks<capacity>(runner);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bench::runner runner(bench::parse_options(argc, argv));
+
+    all_benchmarks<8>(runner);
+    all_benchmarks<64>(runner);
+    all_benchmarks<512>(runner);
+    all_benchmarks<4096>(runner);
+    all_benchmarks<65536>(runner);
+
+    runner.print();
+}
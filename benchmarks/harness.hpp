@@ -0,0 +1,215 @@
+//minimal benchmark harness shared by the container benchmarks. a benchmark runs its body a
+//few times, each run timing a batch of operations and excluding its setup, and reports the
+//fastest run. with --counters, hardware events per operation of that run are reported too
+//where the system allows reading them. results are printed as csv or json so they can be
+//compared between commits
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "perf_counters.hpp"
+
+namespace bench
+{
+    //keeps the compiler from discarding a computed value
+    template <typename T>
+    inline void do_not_optimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    //handed to the benchmark body, which brackets the operations it wants measured
+    class timer
+    {
+        public:
+            explicit timer(perf_counters* counters):
+                m_counters(counters)
+            {
+            }
+            void start()
+            {
+                if(m_counters)
+                    m_counters->start();
+
+                m_start = std::chrono::steady_clock::now();
+            }
+            void stop()
+            {
+                m_elapsed += std::chrono::steady_clock::now() - m_start;
+
+                if(m_counters)
+                    m_counters->stop();
+            }
+            double elapsed_ns() const
+            {
+                return std::chrono::duration<double, std::nano>(m_elapsed).count();
+            }
+        private:
+            perf_counters* m_counters;
+            std::chrono::steady_clock::time_point m_start;
+            std::chrono::steady_clock::duration m_elapsed = {};
+    };
+
+    struct result
+    {
+        std::string container;
+        std::string operation;
+        std::string element;
+        size_t capacity;
+        double ns_per_op;
+        //nan for events that could not be counted
+        std::array<double, counter_count> events_per_op;
+    };
+
+    struct options
+    {
+        bool json = false;
+        bool counters = false;
+        size_t runs = 5;
+        //only benchmarks whose name contains this are run
+        std::string filter;
+    };
+
+    inline options parse_options(int argc, char** argv)
+    {
+        options parsed;
+
+        for(int i = 1; i < argc; ++i)
+        {
+            if(std::strcmp(argv[i], "--json") == 0)
+                parsed.json = true;
+            else if(std::strcmp(argv[i], "--counters") == 0)
+                parsed.counters = true;
+            else if(std::strcmp(argv[i], "--runs") == 0 && i + 1 < argc)
+                parsed.runs = std::max<size_t>(std::stoul(argv[++i]), 1);
+            else if(std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+                parsed.filter = argv[++i];
+            else
+                std::fprintf(stderr, "usage: %s [--json] [--counters] [--runs count] [--filter text]\n", argv[0]);
+        }
+
+        return parsed;
+    }
+
+    class runner
+    {
+        public:
+            explicit runner(options opts):
+                m_options(std::move(opts))
+            {
+                if(m_options.counters)
+                {
+                    m_counters = std::make_unique<perf_counters>();
+
+                    if(!m_counters->any_available())
+                        std::fprintf(stderr, "hardware counters are not available here, check perf_event_paranoid or the container's seccomp profile. reporting times only\n");
+                }
+            }
+
+            //body(timer&) performs ops operations between timer.start() and timer.stop()
+            template <typename body_type>
+            void run(const std::string& container, const std::string& operation, const std::string& element, size_t capacity, size_t ops, body_type&& body)
+            {
+                std::string name = container + "/" + operation + "/" + element + "/" + std::to_string(capacity);
+
+                if(name.find(m_options.filter) == std::string::npos)
+                    return;
+
+                result best = {container, operation, element, capacity, 0.0, {}};
+
+                for(size_t i = 0; i < m_options.runs; ++i)
+                {
+                    if(m_counters)
+                        m_counters->reset();
+
+                    timer measured(m_counters.get());
+                    body(measured);
+
+                    double ns = measured.elapsed_ns() / static_cast<double>(ops);
+
+                    if(i != 0 && ns >= best.ns_per_op)
+                        continue;
+
+                    best.ns_per_op = ns;
+                    for(size_t event = 0; event < counter_count; ++event)
+                    {
+                        bool counted = m_counters && m_counters->available(event);
+                        best.events_per_op[event] = counted ? m_counters->value(event) / static_cast<double>(ops) : std::nan("");
+                    }
+                }
+
+                m_results.push_back(best);
+            }
+
+            void print() const
+            {
+                if(m_options.json)
+                {
+                    std::printf("[\n");
+                    for(size_t i = 0; i < m_results.size(); ++i)
+                    {
+                        const result& r = m_results[i];
+                        std::printf("  {\"container\": \"%s\", \"operation\": \"%s\", \"element\": \"%s\", \"capacity\": %zu, \"ns_per_op\": %.3f",
+                            r.container.c_str(), r.operation.c_str(), r.element.c_str(), r.capacity, r.ns_per_op);
+
+                        if(m_options.counters)
+                        {
+                            for(size_t event = 0; event < counter_count; ++event)
+                            {
+                                if(std::isnan(r.events_per_op[event]))
+                                    std::printf(", \"%s_per_op\": null", counter_name(event));
+                                else
+                                    std::printf(", \"%s_per_op\": %.3f", counter_name(event), r.events_per_op[event]);
+                            }
+                        }
+
+                        std::printf("}%s\n", i + 1 < m_results.size() ? "," : "");
+                    }
+                    std::printf("]\n");
+                }
+                else
+                {
+                    std::printf("container,operation,element,capacity,ns_per_op");
+                    if(m_options.counters)
+                    {
+                        for(size_t event = 0; event < counter_count; ++event)
+                            std::printf(",%s_per_op", counter_name(event));
+                    }
+                    std::printf("\n");
+
+                    //events that could not be counted are left empty
+                    for(const result& r : m_results)
+                    {
+                        std::printf("%s,%s,%s,%zu,%.3f", r.container.c_str(), r.operation.c_str(), r.element.c_str(), r.capacity, r.ns_per_op);
+                        if(m_options.counters)
+                        {
+                            for(size_t event = 0; event < counter_count; ++event)
+                            {
+                                if(std::isnan(r.events_per_op[event]))
+                                    std::printf(",");
+                                else
+                                    std::printf(",%.3f", r.events_per_op[event]);
+                            }
+                        }
+                        std::printf("\n");
+                    }
+                }
+            }
+        private:
+            options m_options;
+            std::unique_ptr<perf_counters> m_counters;
+            std::vector<result> m_results;
+    };
+}
@@ -0,0 +1,112 @@
+//passes elements through static_mpmc_queue with an equal number of producer and consumer
+//threads, from one of each up to as many threads as there are cores, to show how throughput
+//holds up as contention on the shared counters grows. a std::queue behind a std::mutex is run
+//the same way for reference. the thread count is part of the operation name and ns_per_op is
+//per element passed, counting all threads together
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stc/static_mpmc_queue.hpp>
+#include "harness.hpp"
+
+namespace
+{
+    constexpr size_t elements_per_run = 1 << 21;
+    constexpr size_t capacity = 1024;
+
+    //same interface as static_mpmc_queue for the parts the benchmark uses
+    class locked_queue
+    {
+        public:
+            void push(uint64_t value)
+            {
+                while(true)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if(m_queue.size() < capacity)
+                        {
+                            m_queue.push(value);
+                            return;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            }
+            void pop(uint64_t& value)
+            {
+                while(true)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if(!m_queue.empty())
+                        {
+                            value = m_queue.front();
+                            m_queue.pop();
+                            return;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            }
+        private:
+            std::mutex m_mutex;
+            std::queue<uint64_t> m_queue;
+    };
+
+    template <typename queue_type>
+    void pass_elements(bench::runner& runner, const std::string& container, size_t pairs)
+    {
+        runner.run(container, "threads_" + std::to_string(pairs * 2), "uint64_t", capacity, elements_per_run, [pairs](bench::timer& timer)
+        {
+            queue_type queue;
+            std::vector<std::thread> threads;
+            size_t per_thread = elements_per_run / pairs;
+
+            timer.start();
+            for(size_t i = 0; i < pairs; ++i)
+            {
+                threads.emplace_back([&queue, per_thread]()
+                {
+                    for(uint64_t value = 0; value < per_thread; ++value)
+                        queue.push(value);
+                });
+                threads.emplace_back([&queue, per_thread]()
+                {
+                    uint64_t value = 0;
+                    uint64_t sum = 0;
+                    for(size_t received = 0; received < per_thread; ++received)
+                    {
+                        queue.pop(value);
+                        sum += value;
+                    }
+                    bench::do_not_optimize(sum);
+                });
+            }
+
+            for(std::thread& thread : threads)
+                thread.join();
+            timer.stop();
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bench::runner runner(bench::parse_options(argc, argv));
+
+    size_t max_pairs = std::max<size_t>(std::thread::hardware_concurrency() / 2, 1);
+
+    //doubling, and ending at all cores busy
+    for(size_t pairs = 1; pairs <= max_pairs; pairs = pairs == max_pairs ? pairs + 1 : std::min(pairs * 2, max_pairs))
+    {
+        pass_elements<stc::static_mpmc_queue<uint64_t, capacity>>(runner, "static_mpmc_queue", pairs);
+        pass_elements<locked_queue>(runner, "std::queue+std::mutex", pairs);
+    }
+
+    runner.print();
+}
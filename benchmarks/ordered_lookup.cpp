@@ -0,0 +1,64 @@
+//compares lookups in a static_flat_map, which binary searches its sorted keys, with lookups in
+//a frozen_static_map built from it, which searches keys laid out in eytzinger order. output is
+//csv on stdout
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include <stc/frozen_static_map.hpp>
+
+namespace
+{
+    constexpr size_t lookups = 2000000;
+
+    //every looked up key is present
+    template <typename map_type>
+    double time_lookups(const map_type& map, const std::vector<uint32_t>& keys, uint64_t& checksum)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for(uint32_t key : keys)
+            checksum += map.find(key)->second;
+
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(keys.size());
+    }
+
+    template <size_t capacity>
+    void run()
+    {
+        using flat_type = stc::static_flat_map<uint32_t, uint32_t, capacity>;
+        using frozen_type = stc::frozen_static_map<uint32_t, uint32_t, capacity>;
+
+        auto flat = std::make_unique<flat_type>();
+        for(uint32_t i = 0; i < capacity; ++i)
+            (*flat)[i * 2 + 1] = i;
+
+        auto frozen = std::make_unique<frozen_type>(*flat);
+
+        std::mt19937 random(capacity);
+        std::vector<uint32_t> keys(lookups);
+        for(uint32_t& key : keys)
+            key = static_cast<uint32_t>(random() % capacity) * 2 + 1;
+
+        uint64_t flat_checksum = 0;
+        uint64_t frozen_checksum = 0;
+        double flat_ns = time_lookups(*flat, keys, flat_checksum);
+        double frozen_ns = time_lookups(*frozen, keys, frozen_checksum);
+
+        std::printf("static_flat_map,%zu,%.2f,%llu\n", capacity, flat_ns, static_cast<unsigned long long>(flat_checksum));
+        std::printf("frozen_static_map,%zu,%.2f,%llu\n", capacity, frozen_ns, static_cast<unsigned long long>(frozen_checksum));
+    }
+}
+
+int main()
+{
+    std::printf("container,size,ns_per_lookup,checksum\n");
+
+    run<1 << 8>();
+    run<1 << 12>();
+    run<1 << 16>();
+    run<1 << 20>();
+}
@@ -0,0 +1,142 @@
+//hardware event counts for the benchmark harness, read through linux perf_event_open. each
+//event is opened on its own so that the ones the cpu, the kernel settings or a container
+//sandbox do not allow are simply missing rather than disabling the rest. on other platforms
+//no event is available
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench
+{
+    constexpr size_t counter_count = 5;
+
+    inline const char* counter_name(size_t index)
+    {
+        constexpr const char* names[counter_count] = {"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"};
+        return names[index];
+    }
+
+    class perf_counters
+    {
+        public:
+            perf_counters()
+            {
+                m_fds.fill(-1);
+                m_totals.fill(0.0);
+#if defined(__linux__)
+                constexpr uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+                const std::array<std::pair<uint32_t, uint64_t>, counter_count> events =
+                {{
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                    {PERF_TYPE_HW_CACHE, l1d_read_miss},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+                }};
+
+                for(size_t i = 0; i < counter_count; ++i)
+                {
+                    perf_event_attr attributes;
+                    std::memset(&attributes, 0, sizeof(attributes));
+                    attributes.size = sizeof(attributes);
+                    attributes.type = events[i].first;
+                    attributes.config = events[i].second;
+                    attributes.exclude_kernel = 1;
+                    attributes.exclude_hv = 1;
+                    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                    //this thread, any cpu, counting from now on
+                    m_fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+                }
+#endif
+            }
+            perf_counters(const perf_counters&) = delete;
+            perf_counters& operator=(const perf_counters&) = delete;
+            ~perf_counters()
+            {
+#if defined(__linux__)
+                for(int fd : m_fds)
+                {
+                    if(fd != -1)
+                        close(fd);
+                }
+#endif
+            }
+            bool available(size_t index) const
+            {
+                return m_fds[index] != -1;
+            }
+            bool any_available() const
+            {
+                for(size_t i = 0; i < counter_count; ++i)
+                {
+                    if(available(i))
+                        return true;
+                }
+
+                return false;
+            }
+            void reset()
+            {
+                m_totals.fill(0.0);
+            }
+            void start()
+            {
+                for(size_t i = 0; i < counter_count; ++i)
+                    m_started[i] = read_event(i);
+            }
+            void stop()
+            {
+                for(size_t i = 0; i < counter_count; ++i)
+                {
+                    reading stopped = read_event(i);
+                    uint64_t running = stopped.running - m_started[i].running;
+
+                    if(running == 0)
+                        continue;
+
+                    //scaled up by the share of the time the event was actually counted, which is
+                    //less than all of it when the kernel multiplexes more events than the cpu has
+                    //counters for
+                    double enabled = static_cast<double>(stopped.enabled - m_started[i].enabled);
+                    m_totals[i] += static_cast<double>(stopped.value - m_started[i].value) * enabled / static_cast<double>(running);
+                }
+            }
+            //events counted between start and stop calls since the last reset
+            double value(size_t index) const
+            {
+                return m_totals[index];
+            }
+        private:
+            struct reading
+            {
+                uint64_t value = 0;
+                uint64_t enabled = 0;
+                uint64_t running = 0;
+            };
+
+            reading read_event(size_t index) const
+            {
+                reading result;
+#if defined(__linux__)
+                if(m_fds[index] != -1 && read(m_fds[index], &result, sizeof(result)) != static_cast<ssize_t>(sizeof(result)))
+                    result = {};
+#else
+                (void)index;
+#endif
+                return result;
+            }
+
+            std::array<int, counter_count> m_fds;
+            std::array<reading, counter_count> m_started = {};
+            std::array<double, counter_count> m_totals;
+    };
+}
@@ -0,0 +1,111 @@
+//reports how many slots static_map lookups inspect at increasing load factors for each probing
+//policy. group_probing counts groups of 16 slots instead. output is csv on stdout
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include <stc/static_map.hpp>
+
+namespace
+{
+    constexpr size_t capacity = 4096;
+    constexpr size_t lookups = 100000;
+
+    struct summary
+    {
+        double mean;
+        size_t p50;
+        size_t p99;
+        size_t max;
+    };
+
+    summary summarize(std::vector<size_t>& lengths)
+    {
+        std::sort(lengths.begin(), lengths.end());
+
+        double total = 0.0;
+        for(size_t length : lengths)
+            total += static_cast<double>(length);
+
+        auto percentile = [&lengths] (double p)
+        {
+            return lengths[static_cast<size_t>(p * static_cast<double>(lengths.size() - 1))];
+        };
+
+        return {total / static_cast<double>(lengths.size()), percentile(0.5), percentile(0.99), lengths.back()};
+    }
+
+    void print(const char* policy, int load_percent, const char* lookup, summary s)
+    {
+        std::printf("%s,%zu,%d,%s,%.3f,%zu,%zu,%zu\n", policy, capacity, load_percent, lookup, s.mean, s.p50, s.p99, s.max);
+    }
+
+    template <typename probing>
+    void run(const char* policy, int load_percent)
+    {
+        using map_type = stc::static_map<uint64_t, uint64_t, capacity, std::hash<uint64_t>, std::equal_to<uint64_t>, probing>;
+
+        std::mt19937_64 random(load_percent);
+        auto map = std::make_unique<map_type>();
+
+        //churn the map with erases and inserts at the target load like a long lived map would see
+        std::vector<uint64_t> keys;
+        std::unordered_set<uint64_t> present;
+        size_t target_size = capacity * static_cast<size_t>(load_percent) / 100;
+
+        while(keys.size() < target_size)
+        {
+            uint64_t key = random();
+            if(present.insert(key).second)
+            {
+                (*map)[key] = key;
+                keys.push_back(key);
+            }
+        }
+
+        for(size_t i = 0; i < capacity * 4; ++i)
+        {
+            size_t victim = random() % keys.size();
+            map->erase(keys[victim]);
+            present.erase(keys[victim]);
+
+            uint64_t key = random();
+            while(!present.insert(key).second)
+                key = random();
+
+            (*map)[key] = key;
+            keys[victim] = key;
+        }
+
+        std::vector<size_t> hits;
+        std::vector<size_t> misses;
+
+        for(size_t i = 0; i < lookups; ++i)
+        {
+            hits.push_back(map->probe_length(keys[random() % keys.size()]));
+
+            uint64_t absent = random();
+            while(present.count(absent) != 0)
+                absent = random();
+            misses.push_back(map->probe_length(absent));
+        }
+
+        print(policy, load_percent, "hit", summarize(hits));
+        print(policy, load_percent, "miss", summarize(misses));
+    }
+}
+
+int main()
+{
+    std::printf("policy,capacity,load_percent,lookup,mean,p50,p99,max\n");
+
+    for(int load_percent : {50, 75, 90, 95})
+    {
+        run<stc::linear_probing>("linear", load_percent);
+        run<stc::robin_hood_probing>("robin_hood", load_percent);
+        run<stc::group_probing>("group", load_percent);
+    }
+}
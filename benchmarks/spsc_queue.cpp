@@ -0,0 +1,151 @@
+//passes elements between a producer and a consumer thread through static_spsc_queue. the
+//throughput benchmarks report ns per element moved with single and batched pushes and pops, the
+//latency benchmark bounces one element between two queues and reports ns per round trip. the
+//hardware counters, when asked for, only see the thread that runs the timer
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <stc/static_spsc_queue.hpp>
+#include "harness.hpp"
+
+namespace
+{
+    constexpr size_t elements_per_run = 1 << 22;
+    constexpr size_t round_trips = 1 << 16;
+    constexpr size_t batch_size = 32;
+
+    //retries attempt until it succeeds. it spins for a while first and then lets the other thread
+    //run, which matters when both threads share a core
+    template <typename attempt_type>
+    void wait_for(attempt_type&& attempt)
+    {
+        for(size_t spins = 0; !attempt(); ++spins)
+        {
+            if(spins >= 1024)
+                std::this_thread::yield();
+        }
+    }
+
+    template <size_t capacity>
+    void single_throughput(bench::runner& runner)
+    {
+        runner.run("static_spsc_queue", "throughput", "uint64_t", capacity, elements_per_run, [](bench::timer& timer)
+        {
+            stc::static_spsc_queue<uint64_t, capacity> queue;
+
+            timer.start();
+            std::thread consumer([&queue]()
+            {
+                uint64_t value = 0;
+                uint64_t sum = 0;
+                for(size_t received = 0; received < elements_per_run; ++received)
+                {
+                    wait_for([&]() { return queue.try_pop(value); });
+                    sum += value;
+                }
+                bench::do_not_optimize(sum);
+            });
+
+            for(uint64_t i = 0; i < elements_per_run; ++i)
+                wait_for([&]() { return queue.try_push(i); });
+
+            consumer.join();
+            timer.stop();
+        });
+    }
+
+    template <size_t capacity>
+    void batch_throughput(bench::runner& runner)
+    {
+        runner.run("static_spsc_queue", "batch_throughput", "uint64_t", capacity, elements_per_run, [](bench::timer& timer)
+        {
+            stc::static_spsc_queue<uint64_t, capacity> queue;
+
+            timer.start();
+            std::thread consumer([&queue]()
+            {
+                std::array<uint64_t, batch_size> values;
+                uint64_t sum = 0;
+                for(size_t received = 0; received < elements_per_run;)
+                {
+                    size_t popped = 0;
+                    wait_for([&]() { return (popped = queue.try_pop_n(values.begin(), values.size())) != 0; });
+                    for(size_t i = 0; i < popped; ++i)
+                        sum += values[i];
+                    received += popped;
+                }
+                bench::do_not_optimize(sum);
+            });
+
+            std::array<uint64_t, batch_size> values;
+            for(uint64_t next = 0; next < elements_per_run;)
+            {
+                for(size_t i = 0; i < values.size(); ++i)
+                    values[i] = next + i;
+
+                size_t pushed = 0;
+                wait_for([&]() { return (pushed = queue.try_push_n(values.begin(), values.size())) != 0; });
+                next += pushed;
+            }
+
+            consumer.join();
+            timer.stop();
+        });
+    }
+
+    template <size_t capacity>
+    void round_trip_latency(bench::runner& runner)
+    {
+        runner.run("static_spsc_queue", "round_trip", "uint64_t", capacity, round_trips, [](bench::timer& timer)
+        {
+            stc::static_spsc_queue<uint64_t, capacity> ping;
+            stc::static_spsc_queue<uint64_t, capacity> pong;
+            std::atomic<bool> ready = false;
+
+            std::thread echo([&]()
+            {
+                ready.store(true);
+                uint64_t value = 0;
+                for(size_t i = 0; i < round_trips; ++i)
+                {
+                    wait_for([&]() { return ping.try_pop(value); });
+                    wait_for([&]() { return pong.try_push(value + 1); });
+                }
+            });
+
+            wait_for([&]() { return ready.load(); });
+
+            uint64_t value = 0;
+            timer.start();
+            for(size_t i = 0; i < round_trips; ++i)
+            {
+                wait_for([&]() { return ping.try_push(value); });
+                wait_for([&]() { return pong.try_pop(value); });
+            }
+            timer.stop();
+
+            echo.join();
+            bench::do_not_optimize(value);
+        });
+    }
+
+    template <size_t capacity>
+    void all_benchmarks(bench::runner& runner)
+    {
+        single_throughput<capacity>(runner);
+        batch_throughput<capacity>(runner);
+        round_trip_latency<capacity>(runner);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bench::runner runner(bench::parse_options(argc, argv));
+
+    all_benchmarks<64>(runner);
+    all_benchmarks<1024>(runner);
+    all_benchmarks<16384>(runner);
+
+    runner.print();
+}
@@ -1,8 +1,58 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <new>
 
+#if !defined(STC_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define STC_SSE2 1
+#endif
+
+#if !defined(STC_NO_SIMD) && defined(__AVX2__)
+#define STC_AVX2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//c++20 lets containers construct and destroy elements in constant expressions
+#if (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) && defined(__cpp_constexpr_dynamic_alloc)
+#include <memory>
+#define STC_CONSTEXPR_STORAGE 1
+#define STC_CONSTEXPR20 constexpr
+#else
+#define STC_CONSTEXPR_STORAGE 0
+#define STC_CONSTEXPR20
+#endif
+
+//memory given back to the static pools is filled with a pattern in debug builds, so that reads
+//after free give recognizable garbage. define STC_POOL_POISONING as 0 or 1 to override
+#if !defined(STC_POOL_POISONING)
+#if defined(NDEBUG)
+#define STC_POOL_POISONING 0
+#else
+#define STC_POOL_POISONING 1
+#endif
+#endif
+
+//under address sanitizer the pools also mark memory they do not hand out as unaddressable
+#if defined(__SANITIZE_ADDRESS__)
+#define STC_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define STC_ASAN 1
+#endif
+#endif
+
+#if defined(STC_ASAN)
+#include <sanitizer/asan_interface.h>
+#endif
+
 namespace stc
 {
     template<typename T>
@@ -38,7 +88,216 @@ namespace stc
     template <typename T>
     inline constexpr bool is_input_iterator_v = is_input_iterator<T>::value;
 
+    template<typename T, typename = void>
+    struct is_forward_iterator: std::false_type {};
+
+    template<typename T>
+    struct is_forward_iterator<T, std::void_t<typename std::iterator_traits<T>::iterator_category>>:
+        std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<T>::iterator_category> {};
+
+    template<typename T>
+    inline constexpr bool is_forward_iterator_v = is_forward_iterator<T>::value;
+
+    //types whose objects can be moved to another address by copying their bytes, leaving
+    //nothing to destroy at the old one. containers shift such elements with memmove.
+    //specialise it for types that qualify without being trivially copyable, such as most
+    //types that only own a heap pointer
+    template<typename T>
+    struct is_trivially_relocatable: std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    //function objects declaring is_transparent accept any type they can compare or hash, so
+    //lookups need not construct a key
+    template<typename T, typename = void>
+    struct is_transparent: std::false_type {};
+
+    template<typename T>
+    struct is_transparent<T, std::void_t<typename T::is_transparent>>: std::true_type {};
+
+    template<typename T>
+    inline constexpr bool is_transparent_v = is_transparent<T>::value;
+
+    //smallest unsigned integer type able to represent max_value
+    template <size_t max_value>
+    using smallest_unsigned_t =
+        std::conditional_t<max_value <= UINT8_MAX, uint8_t,
+        std::conditional_t<max_value <= UINT16_MAX, uint16_t,
+        std::conditional_t<max_value <= UINT32_MAX, uint32_t,
+        uint64_t>>>;
+
+    //index of the lowest set bit. value must not be zero
+    inline unsigned count_trailing_zeros(uint64_t value)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+    }
+
+    //hints the cpu to start loading the cache line holding address. never faults
+    inline void prefetch(const void* address)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#elif defined(_MSC_VER) && defined(STC_SSE2)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+    //assumed size of a cache line. data written by different threads is kept this far apart
+    //so that the threads do not keep taking the line from each other
+    inline constexpr size_t cache_line_size = 64;
+
+    //one bit per slot packed into 64 bit words, for containers tracking which slots are in use
+    template <size_t t_bit_count>
+    class occupancy_bitmap
+    {
+        public:
+            static constexpr size_t bit_count = t_bit_count;
+
+            bool test(size_t index) const
+            {
+                return (m_words[index / word_bits] >> (index % word_bits)) & 1u;
+            }
+
+            void set(size_t index)
+            {
+                m_words[index / word_bits] |= uint64_t(1) << (index % word_bits);
+            }
+
+            void reset(size_t index)
+            {
+                m_words[index / word_bits] &= ~(uint64_t(1) << (index % word_bits));
+            }
+
+            //first set bit at or after index, or bit_count if there is none
+            size_t find_next_set(size_t index) const
+            {
+                if(index >= bit_count)
+                    return bit_count;
+
+                size_t word = index / word_bits;
+                uint64_t bits = m_words[word] & (~uint64_t(0) << (index % word_bits));
+
+                while(bits == 0)
+                {
+                    if(++word == word_count)
+                        return bit_count;
+
+                    bits = m_words[word];
+                }
+
+                return word * word_bits + count_trailing_zeros(bits);
+            }
+        private:
+            static constexpr size_t word_bits = 64;
+            static constexpr size_t word_count = (bit_count + word_bits - 1) / word_bits;
+
+            std::array<uint64_t, word_count> m_words = {};
+    };
+
+
+    //byte pattern filling memory given back to a pool, see STC_POOL_POISONING
+    inline constexpr unsigned char freed_memory_pattern = 0xdd;
+
+    inline void fill_freed_memory(void* address, size_t size)
+    {
+#if STC_POOL_POISONING
+        std::memset(address, freed_memory_pattern, size);
+#else
+        (void)address;
+        (void)size;
+#endif
+    }
+
+    //makes address sanitizer report accesses to memory a pool does not hand out
+    inline void mark_memory_unaddressable(const void* address, size_t size)
+    {
+#if defined(STC_ASAN)
+        ASAN_POISON_MEMORY_REGION(address, size);
+#else
+        (void)address;
+        (void)size;
+#endif
+    }
+
+    inline void mark_memory_addressable(const void* address, size_t size)
+    {
+#if defined(STC_ASAN)
+        ASAN_UNPOISON_MEMORY_REGION(address, size);
+#else
+        (void)address;
+        (void)size;
+#endif
+    }
+
+    //true while evaluating a constant expression, where raw memory functions like memcpy
+    //cannot be used
+    constexpr bool in_constant_evaluation()
+    {
+#if STC_CONSTEXPR_STORAGE
+        return std::is_constant_evaluated();
+#else
+        return false;
+#endif
+    }
+
+#if STC_CONSTEXPR_STORAGE
+    //a union member can be constructed and destroyed in a constant expression, unlike an
+    //object placed in raw bytes
+    template <typename value_type_in>
+    struct container_storage
+    {
+        using value_type = value_type_in;
+
+        constexpr container_storage() {}
+        constexpr ~container_storage() requires std::is_trivially_destructible_v<value_type> = default;
+        constexpr ~container_storage() {}
+
+        constexpr void destroy()
+        {
+            std::destroy_at(&m_value);
+        }
+
+        constexpr void set(value_type&& v)
+        {
+            std::construct_at(&m_value, std::forward<value_type>(v));
+        }
+
+        constexpr void set(const value_type& v)
+        {
+            std::construct_at(&m_value, v);
+        }
+
+        template<typename ...Args>
+        constexpr void set(Args&&... args)
+        {
+            std::construct_at(&m_value, std::forward<Args>(args)...);
+        }
 
+        constexpr value_type& get()
+        {
+            return m_value;
+        }
+
+        constexpr const value_type& get() const
+        {
+            return m_value;
+        }
+
+        union
+        {
+            value_type m_value;
+        };
+    };
+#else
     template <typename value_type_in>
     struct container_storage
     {
@@ -77,6 +336,7 @@ namespace stc
 
         typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type m_data;
     };
+#endif
 
     template <typename value_type_in>
     struct optional_container_storage
@@ -117,7 +377,7 @@ namespace stc
             has_value = other.has_value;
             if(other.has_value)
             {
-                value = other.value;
+                value.set(other.get());
             }
 
             return *this;
@@ -128,6 +388,9 @@ namespace stc
         }
         optional_container_storage& operator=(optional_container_storage&& other)
         {
+            if(&other == this)
+                return *this;
+
             if(has_value)
                 value.destroy();
             
@@ -135,7 +398,7 @@ namespace stc
 
             if(other.has_value)
             {
-                value = std::move(other.value);
+                value.set(std::move(other.get()));
                 other.value.destroy();
                 other.has_value = false;
             }
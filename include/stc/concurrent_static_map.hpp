@@ -0,0 +1,184 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <stc/common.hpp>
+#include <stc/static_map.hpp>
+
+namespace stc
+{
+    //static_map for many reader threads and rarely writing ones. two copies of the map are kept,
+    //after the left-right technique of pedro ramalhete and andreia correia: readers always use
+    //the copy that is currently published, and a writer changes the other one, publishes it with
+    //a single atomic store, waits until no reader can still be in the old copy and then applies
+    //the same change to that one too. a read announces itself on one of two counters, reads the
+    //published copy and leaves again, a fixed number of steps that never waits on a writer or
+    //on other readers. writers are serialized by a mutex and wait for readers, so they pay for
+    //the lock free reads. all changes made in one modify call become visible together
+    template <typename t_key_type, typename t_mapped_type, size_t t_capacity, typename t_hash = std::hash<t_key_type>, typename t_key_equal = std::equal_to<t_key_type>, typename t_probing = linear_probing>
+    class concurrent_static_map
+    {
+        public:
+            //collect_stats is not offered since it writes to the map on every lookup
+            using map_type = static_map<t_key_type, t_mapped_type, t_capacity, t_hash, t_key_equal, t_probing>;
+            using key_type = typename map_type::key_type;
+            using mapped_type = typename map_type::mapped_type;
+            using value_type = typename map_type::value_type;
+            using size_type = typename map_type::size_type;
+            static constexpr size_type capacity = t_capacity;
+
+            //constructors
+            concurrent_static_map() = default;
+            explicit concurrent_static_map(const map_type& initial):
+                m_maps{{initial, initial}}
+            {
+            }
+            concurrent_static_map(const concurrent_static_map&) = delete;
+            concurrent_static_map(concurrent_static_map&&) = delete;
+            //assignment
+            concurrent_static_map& operator=(const concurrent_static_map&) = delete;
+            concurrent_static_map& operator=(concurrent_static_map&&) = delete;
+            //readers. never block. reader(const map_type&) is called on the published copy and
+            //what it returns must not refer into the map, since a writer may change that copy
+            //as soon as the read is over
+            template <typename reader_type>
+            decltype(auto) read(reader_type&& reader) const
+            {
+                size_t version = m_version.load();
+                m_readers[version].count.fetch_add(1);
+
+                //leaves the read indicator even if reader throws
+                struct departure
+                {
+                    ~departure()
+                    {
+                        readers.fetch_sub(1);
+                    }
+
+                    std::atomic<size_t>& readers;
+                } leave{m_readers[version].count};
+
+                return std::invoke(std::forward<reader_type>(reader), std::as_const(m_maps[m_published.load()]));
+            }
+            bool contains(const key_type& key) const
+            {
+                return read([&key](const map_type& map) { return map.contains(key); });
+            }
+            //a copy of the value, since the entry itself may change after the read
+            std::optional<mapped_type> get(const key_type& key) const
+            {
+                return read([&key](const map_type& map) -> std::optional<mapped_type>
+                {
+                    auto found = map.find(key);
+
+                    if(found == map.end())
+                        return std::nullopt;
+
+                    return found->second;
+                });
+            }
+            size_type size() const
+            {
+                return read([](const map_type& map) { return map.size(); });
+            }
+            bool empty() const
+            {
+                return size() == 0;
+            }
+            //writers. writer(map_type&) is called once on each copy, so it has to make the same
+            //change both times, and should neither throw nor have other side effects. returns
+            //what the first call returned
+            template <typename writer_type>
+            decltype(auto) modify(writer_type&& writer)
+            {
+                std::lock_guard<std::mutex> lock(m_writer_mutex);
+
+                size_t published = m_published.load(std::memory_order_relaxed);
+
+                if constexpr(std::is_void_v<std::invoke_result_t<writer_type&, map_type&>>)
+                {
+                    std::invoke(writer, m_maps[1 - published]);
+                    publish(1 - published);
+                    std::invoke(writer, m_maps[published]);
+                }
+                else
+                {
+                    auto result = std::invoke(writer, m_maps[1 - published]);
+                    publish(1 - published);
+                    std::invoke(writer, m_maps[published]);
+                    return result;
+                }
+            }
+            //returns false if the key was present already
+            bool insert(const value_type& entry)
+            {
+                return modify([&entry](map_type& map) { return map.insert(entry).second; });
+            }
+            void insert_or_assign(const key_type& key, const mapped_type& value)
+            {
+                modify([&](map_type& map) { map[key] = value; });
+            }
+            //returns false if the key was not present
+            bool erase(const key_type& key)
+            {
+                return modify([&key](map_type& map)
+                {
+                    if(!map.contains(key))
+                        return false;
+
+                    map.erase(key);
+                    return true;
+                });
+            }
+            void clear()
+            {
+                modify([](map_type& map) { map.clear(); });
+            }
+            //publishes a whole new version of the map at once
+            void replace(const map_type& next)
+            {
+                modify([&next](map_type& map) { map = next; });
+            }
+        private:
+            //makes the copy at index the one new reads go to and returns once every read of
+            //the other copy is over
+            void publish(size_t index)
+            {
+                m_published.store(index);
+
+                //readers counted on the current indicator may be using either copy. new readers
+                //are sent to the other indicator, once it is drained of readers left over from
+                //the previous publish, and then the current one is waited out
+                size_t version = m_version.load(std::memory_order_relaxed);
+                wait_for_readers(1 - version);
+                m_version.store(1 - version);
+                wait_for_readers(version);
+            }
+            void wait_for_readers(size_t version) const
+            {
+                for(size_t spins = 0; m_readers[version].count.load() != 0; ++spins)
+                {
+                    if(spins >= 64)
+                        std::this_thread::yield();
+                }
+            }
+
+            //each counter on its own cache line, they are written by every read
+            struct alignas(cache_line_size) read_indicator
+            {
+                std::atomic<size_t> count = 0;
+            };
+
+            alignas(cache_line_size) std::atomic<size_t> m_published = 0;
+            std::atomic<size_t> m_version = 0;
+            std::mutex m_writer_mutex;
+            mutable std::array<read_indicator, 2> m_readers;
+            std::array<map_type, 2> m_maps;
+    };
+}
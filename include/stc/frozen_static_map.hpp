@@ -0,0 +1,254 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <stc/common.hpp>
+#include <stc/static_flat_map.hpp>
+
+namespace stc
+{
+    //read-only ordered map built once from a static_flat_map. the keys are laid out in
+    //eytzinger order, the breadth first order of the implicit binary search tree, so the first
+    //levels of every search share the same few cache lines and the nodes a search visits next
+    //can be prefetched. searches are branchless. iteration visits entries in layout order, not
+    //key order. key_compare is expected to be stateless and is default constructed on use
+    template <typename t_key_type, typename t_mapped_type, size_t t_capacity, typename t_compare = std::less<t_key_type>>
+    class frozen_static_map
+    {
+        public:
+            using key_type = t_key_type;
+            using mapped_type = t_mapped_type;
+            using key_compare = t_compare;
+            using size_type = size_t;
+            using difference_type = std::ptrdiff_t;
+            using value_type = typename static_flat_map<key_type, mapped_type, t_capacity, key_compare>::value_type;
+
+            struct const_reference
+            {
+                const key_type& first;
+                const mapped_type& second;
+            };
+
+            using reference = const_reference;
+
+            struct const_iterator
+            {
+                using difference_type = std::ptrdiff_t;
+                using value_type = frozen_static_map::value_type;
+                using reference = const_reference;
+                using iterator_category = std::forward_iterator_tag;
+
+                struct pointer
+                {
+                    const reference* operator->() const
+                    {
+                        return &target;
+                    }
+
+                    reference target;
+                };
+
+                const_iterator& operator++()
+                {
+                    ++index;
+                    return *this;
+                }
+
+                const_iterator operator++(int)
+                {
+                    const_iterator tmp = *this;
+                    operator++();
+                    return tmp;
+                }
+
+                reference operator*() const
+                {
+                    return {map->m_keys[index].get(), map->m_values[index].get()};
+                }
+
+                pointer operator->() const
+                {
+                    return {**this};
+                }
+
+                bool operator==(const const_iterator& other) const
+                {
+                    return index == other.index;
+                }
+
+                bool operator!=(const const_iterator& other) const
+                {
+                    return !(*this == other);
+                }
+
+                const frozen_static_map* map = nullptr;
+                size_type index = 0;
+            };
+
+            using iterator = const_iterator;
+
+            static constexpr size_type capacity = t_capacity;
+
+            //constructors
+            explicit frozen_static_map(const static_flat_map<key_type, mapped_type, capacity, key_compare>& sorted):
+                m_size(sorted.size())
+            {
+                if(m_size == 0)
+                    return;
+
+                //visit the tree nodes in order, which matches the sorted order of the source.
+                //nodes are numbered from 1 so the children of node k are 2k and 2k + 1
+                size_type node = leftmost_descendant(1);
+
+                for(auto entry : sorted)
+                {
+                    m_keys[node - 1].set(entry.first);
+                    m_values[node - 1].set(entry.second);
+
+                    if(2 * node + 1 <= m_size)
+                    {
+                        node = leftmost_descendant(2 * node + 1);
+                    }
+                    else
+                    {
+                        //climb past every node we are the right child of, then once more
+                        while(node & 1)
+                            node >>= 1;
+                        node >>= 1;
+                    }
+                }
+            }
+            frozen_static_map(const frozen_static_map& other):
+                m_size(other.m_size)
+            {
+                for(size_type i = 0; i < m_size; ++i)
+                {
+                    m_keys[i].set(other.m_keys[i].get());
+                    m_values[i].set(other.m_values[i].get());
+                }
+            }
+            frozen_static_map(frozen_static_map&& other):
+                m_size(other.m_size)
+            {
+                for(size_type i = 0; i < m_size; ++i)
+                {
+                    m_keys[i].set(std::move(other.m_keys[i].get()));
+                    m_values[i].set(std::move(other.m_values[i].get()));
+                }
+            }
+            //destructor
+            ~frozen_static_map()
+            {
+                for(size_type i = 0; i < m_size; ++i)
+                {
+                    m_keys[i].destroy();
+                    m_values[i].destroy();
+                }
+            }
+            frozen_static_map& operator=(const frozen_static_map&) = delete;
+            frozen_static_map& operator=(frozen_static_map&&) = delete;
+            //element access
+            const mapped_type& at(const key_type& key) const
+            {
+                size_type index = find_index(key);
+
+                if(index == m_size)
+                {
+                    throw std::out_of_range("accessing key not in frozen_static_map");
+                }
+                return m_values[index].get();
+            }
+            //iterators
+            const_iterator begin() const
+            {
+                return {this, 0};
+            }
+            const_iterator cbegin() const
+            {
+                return begin();
+            }
+            const_iterator end() const
+            {
+                return {this, m_size};
+            }
+            const_iterator cend() const
+            {
+                return end();
+            }
+            //capacity
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+            size_type size() const
+            {
+                return m_size;
+            }
+            //lookup
+            size_type count(const key_type& key) const
+            {
+                return static_cast<size_type>(contains(key));
+            }
+            bool contains(const key_type& key) const
+            {
+                return find_index(key) != m_size;
+            }
+            const_iterator find(const key_type& key) const
+            {
+                return {this, find_index(key)};
+            }
+        private:
+            using key_storage = container_storage<key_type>;
+
+            //the descendants of a node a few levels down are consecutive and start at node *
+            //prefetch_stride, so prefetching there loads the cache line holding all of them
+            //before the search needs it. only worth it once the keys no longer fit in l1
+            static constexpr size_type prefetch_stride = std::max<size_type>(64 / sizeof(key_storage), 1);
+            static constexpr bool prefetching = capacity * sizeof(key_storage) > 32 * 1024;
+
+            size_type leftmost_descendant(size_type node) const
+            {
+                while(2 * node <= m_size)
+                    node *= 2;
+
+                return node;
+            }
+            //index of the key, or size() if it is not in the map
+            size_type find_index(const key_type& key) const
+            {
+                size_type node = 1;
+
+                while(node <= m_size)
+                {
+                    if constexpr(prefetching)
+                        prefetch(&m_keys[std::min(node * prefetch_stride, capacity) - 1]);
+
+                    node = 2 * node + key_compare{}(m_keys[node - 1].get(), key);
+                }
+
+                //the path went right at every node less than the key. undoing the trailing
+                //right turns and the final left turn leaves the first node not less than it,
+                //or 0 if there is none
+                node >>= count_trailing_zeros(~static_cast<uint64_t>(node)) + 1;
+
+                if(node == 0 || key_compare{}(key, m_keys[node - 1].get()))
+                    return m_size;
+
+                return node - 1;
+            }
+
+            size_type m_size;
+            std::array<key_storage, capacity> m_keys;
+            std::array<container_storage<mapped_type>, capacity> m_values;
+    };
+
+    template<typename key_type, typename mapped_type, size_t capacity>
+    auto make_frozen_static_map(typename static_flat_map<key_type, mapped_type, capacity>::value_type const (&arr)[capacity])
+    {
+        return frozen_static_map<key_type, mapped_type, capacity>{static_flat_map<key_type, mapped_type, capacity>{arr}};
+    }
+}
@@ -0,0 +1,263 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace stc
+{
+    //hash taking a seed, so a perfect_static_map can keep drawing new hash functions until it
+    //finds ones without collisions. usable in constant expressions. specialise it for other
+    //key types
+    template <typename T, typename = void>
+    struct seeded_hash;
+
+    constexpr uint64_t mix_bits(uint64_t value)
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    template <typename T>
+    struct seeded_hash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+    {
+        constexpr uint64_t operator()(T key, uint64_t seed) const
+        {
+            return mix_bits(static_cast<uint64_t>(key) ^ mix_bits(seed));
+        }
+    };
+
+    template <>
+    struct seeded_hash<std::string_view>
+    {
+        constexpr uint64_t operator()(std::string_view key, uint64_t seed) const
+        {
+            //fnv-1a
+            uint64_t hash = 0xcbf29ce484222325ull ^ mix_bits(seed);
+            for(char c : key)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 0x100000001b3ull;
+            }
+            return mix_bits(hash);
+        }
+    };
+
+    //immutable map whose entries and hash functions are all computed in a constant expression,
+    //so building it costs nothing at runtime. lookups are one bucket hash, one slot hash and
+    //one key comparison. keys are split into buckets by a first hash, then each bucket gets
+    //its own seed for a second hash that sends all of its keys to distinct free slots, largest
+    //buckets first. buckets of a single key store their slot directly. keys and values must be
+    //literal and default constructible
+    template <typename t_key_type, typename t_mapped_type, size_t t_size, typename t_hash = seeded_hash<t_key_type>, typename t_key_equal = std::equal_to<t_key_type>>
+    class perfect_static_map
+    {
+        public:
+            using key_type = t_key_type;
+            using mapped_type = t_mapped_type;
+            using hasher = t_hash;
+            using key_equal = t_key_equal;
+            using size_type = size_t;
+
+            struct pair
+            {
+                key_type first = {};
+                mapped_type second = {};
+            };
+
+            using value_type = pair;
+            using const_reference = const value_type&;
+            using reference = const_reference;
+            using const_iterator = const value_type*;
+            using iterator = const_iterator;
+
+            static_assert(t_size > 0, "perfect_static_map needs at least one entry");
+
+            constexpr perfect_static_map(value_type const (&entries)[t_size]):
+                m_displacements(),
+                m_entries()
+            {
+                std::array<size_type, t_size> bucket_of = {};
+                std::array<size_type, t_size> bucket_sizes = {};
+
+                for(size_type i = 0; i < t_size; ++i)
+                {
+                    bucket_of[i] = bucket_index(entries[i].first);
+                    ++bucket_sizes[bucket_of[i]];
+                }
+
+                //buckets by descending size. insertion sort since std::sort is not constexpr
+                std::array<size_type, t_size> order = {};
+                for(size_type i = 0; i < t_size; ++i)
+                {
+                    size_type j = i;
+                    for(; j > 0 && bucket_sizes[order[j - 1]] < bucket_sizes[i]; --j)
+                        order[j] = order[j - 1];
+                    order[j] = i;
+                }
+
+                std::array<bool, t_size> taken = {};
+                size_type next_free = 0;
+
+                for(size_type bucket : order)
+                {
+                    if(bucket_sizes[bucket] == 0)
+                        break;
+
+                    if(bucket_sizes[bucket] == 1)
+                    {
+                        while(taken[next_free])
+                            ++next_free;
+
+                        for(size_type i = 0; i < t_size; ++i)
+                        {
+                            if(bucket_of[i] == bucket)
+                                place(entries[i], next_free, taken);
+                        }
+
+                        m_displacements[bucket] = -static_cast<int64_t>(next_free) - 1;
+                        continue;
+                    }
+
+                    for(uint64_t seed = 1;; ++seed)
+                    {
+                        if(try_displace(entries, bucket_of, bucket, seed, taken))
+                        {
+                            m_displacements[bucket] = static_cast<int64_t>(seed);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            constexpr const mapped_type& at(const key_type& key) const
+            {
+                const_iterator found = find(key);
+
+                if(found == end())
+                {
+                    throw std::out_of_range("accessing key not in perfect_static_map");
+                }
+                return found->second;
+            }
+            constexpr const_iterator find(const key_type& key) const
+            {
+                size_type slot = slot_index(key);
+
+                if(!key_equal{}(m_entries[slot].first, key))
+                    return end();
+
+                return m_entries.data() + slot;
+            }
+            constexpr bool contains(const key_type& key) const
+            {
+                return find(key) != end();
+            }
+            constexpr size_type count(const key_type& key) const
+            {
+                return static_cast<size_type>(contains(key));
+            }
+            constexpr const_iterator begin() const
+            {
+                return m_entries.data();
+            }
+            constexpr const_iterator end() const
+            {
+                return m_entries.data() + t_size;
+            }
+            constexpr size_type size() const
+            {
+                return t_size;
+            }
+            constexpr bool empty() const
+            {
+                return false;
+            }
+        private:
+            static constexpr uint64_t bucket_seed = 0x9e3779b97f4a7c15ull;
+
+            static constexpr size_type bucket_index(const key_type& key)
+            {
+                return static_cast<size_type>(hasher{}(key, bucket_seed) % t_size);
+            }
+
+            static constexpr size_type displaced_index(const key_type& key, uint64_t seed)
+            {
+                return static_cast<size_type>(hasher{}(key, seed) % t_size);
+            }
+
+            constexpr size_type slot_index(const key_type& key) const
+            {
+                int64_t displacement = m_displacements[bucket_index(key)];
+
+                if(displacement < 0)
+                    return static_cast<size_type>(-displacement - 1);
+
+                return displaced_index(key, static_cast<uint64_t>(displacement));
+            }
+
+            constexpr void place(const value_type& entry, size_type slot, std::array<bool, t_size>& taken)
+            {
+                m_entries[slot].first = entry.first;
+                m_entries[slot].second = entry.second;
+                taken[slot] = true;
+            }
+
+            //places every entry of the bucket if the seed sends them all to distinct free slots
+            constexpr bool try_displace(value_type const (&entries)[t_size], const std::array<size_type, t_size>& bucket_of, size_type bucket, uint64_t seed, std::array<bool, t_size>& taken)
+            {
+                std::array<size_type, t_size> slots = {};
+                std::array<size_type, t_size> members = {};
+                size_type member_count = 0;
+
+                for(size_type i = 0; i < t_size; ++i)
+                {
+                    if(bucket_of[i] != bucket)
+                        continue;
+
+                    size_type slot = displaced_index(entries[i].first, seed);
+
+                    if(taken[slot])
+                        return false;
+
+                    for(size_type j = 0; j < member_count; ++j)
+                    {
+                        if(slots[j] == slot)
+                        {
+                            //no seed can ever separate equal keys
+                            if(key_equal{}(entries[members[j]].first, entries[i].first))
+                                throw std::invalid_argument("duplicate key in perfect_static_map");
+
+                            return false;
+                        }
+                    }
+
+                    slots[member_count] = slot;
+                    members[member_count] = i;
+                    ++member_count;
+                }
+
+                for(size_type j = 0; j < member_count; ++j)
+                    place(entries[members[j]], slots[j], taken);
+
+                return true;
+            }
+
+            //per bucket, the seed for the slot hash, or minus one minus the slot of its only key
+            std::array<int64_t, t_size> m_displacements;
+            std::array<value_type, t_size> m_entries;
+    };
+
+    template<typename key_type, typename mapped_type, size_t size>
+    constexpr auto make_perfect_static_map(typename perfect_static_map<key_type, mapped_type, size>::value_type const (&arr)[size])
+    {
+        return perfect_static_map<key_type, mapped_type, size>{arr};
+    }
+}
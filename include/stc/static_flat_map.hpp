@@ -0,0 +1,441 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <stc/static_vector.hpp>
+
+namespace stc
+{
+    //ordered map keeping its keys sorted in one contiguous array and the mapped values in a
+    //parallel one, so searches only touch keys. lookups use a branchless binary search.
+    //insertion and erasure shift the entries after the position. key_compare is expected to
+    //be stateless and is default constructed on use
+    template <typename t_key_type, typename t_mapped_type, size_t t_capacity, typename t_compare = std::less<t_key_type>>
+    class static_flat_map
+    {
+        public:
+            using key_type = t_key_type;
+            using mapped_type = t_mapped_type;
+            using key_compare = t_compare;
+            using size_type = size_t;
+            using difference_type = std::ptrdiff_t;
+
+            struct pair
+            {
+                key_type first;
+                mapped_type second;
+            };
+
+            using value_type = pair;
+
+            //keys and values are stored apart, so elements are accessed through a pair of
+            //references rather than a reference to a pair
+            template <typename iter_mapped_type>
+            struct reference_t
+            {
+                const key_type& first;
+                iter_mapped_type& second;
+            };
+
+            using reference = reference_t<mapped_type>;
+            using const_reference = reference_t<const mapped_type>;
+
+            template <typename iter_mapped_type>
+            struct iterator_t
+            {
+                using difference_type = std::ptrdiff_t;
+                using value_type = pair;
+                using reference = reference_t<iter_mapped_type>;
+                using iterator_category = std::random_access_iterator_tag;
+                using map_pointer = std::conditional_t<std::is_const_v<iter_mapped_type>, const static_flat_map*, static_flat_map*>;
+
+                struct pointer
+                {
+                    reference* operator->()
+                    {
+                        return &target;
+                    }
+
+                    reference target;
+                };
+
+                iterator_t& operator++()
+                {
+                    ++index;
+                    return *this;
+                }
+
+                iterator_t operator++(int)
+                {
+                    iterator_t tmp = *this;
+                    operator++();
+                    return tmp;
+                }
+
+                iterator_t& operator--()
+                {
+                    --index;
+                    return *this;
+                }
+
+                iterator_t operator--(int)
+                {
+                    iterator_t tmp = *this;
+                    operator--();
+                    return tmp;
+                }
+
+                iterator_t& operator+=(difference_type diff)
+                {
+                    index += diff;
+                    return *this;
+                }
+
+                iterator_t operator+(difference_type diff) const
+                {
+                    iterator_t tmp = *this;
+                    tmp.index += diff;
+                    return tmp;
+                }
+
+                friend iterator_t operator+(difference_type diff, const iterator_t& iter)
+                {
+                    return iter + diff;
+                }
+
+                iterator_t& operator-=(difference_type diff)
+                {
+                    index -= diff;
+                    return *this;
+                }
+
+                difference_type operator-(iterator_t iter) const
+                {
+                    return static_cast<difference_type>(index) - static_cast<difference_type>(iter.index);
+                }
+
+                iterator_t operator-(difference_type diff) const
+                {
+                    iterator_t tmp = *this;
+                    tmp.index -= diff;
+                    return tmp;
+                }
+
+                reference operator*() const
+                {
+                    return {map->m_keys[index], map->m_values[index]};
+                }
+
+                pointer operator->() const
+                {
+                    return {**this};
+                }
+
+                reference operator[](difference_type offset) const
+                {
+                    return *(*this + offset);
+                }
+
+                bool operator==(const iterator_t& other) const
+                {
+                    return index == other.index;
+                }
+
+                bool operator!=(const iterator_t& other) const
+                {
+                    return !(*this == other);
+                }
+
+                bool operator<(const iterator_t& other) const
+                {
+                    return index < other.index;
+                }
+
+                bool operator>(const iterator_t& other) const
+                {
+                    return index > other.index;
+                }
+
+                bool operator<=(const iterator_t& other) const
+                {
+                    return index <= other.index;
+                }
+
+                bool operator>=(const iterator_t& other) const
+                {
+                    return index >= other.index;
+                }
+
+                template<typename U = iter_mapped_type, typename = typename std::enable_if_t<!std::is_const_v<U>>>
+                operator iterator_t<const U>() const
+                {
+                    return {map, index};
+                }
+
+                map_pointer map = nullptr;
+                size_type index = 0;
+            };
+
+            using iterator = iterator_t<mapped_type>;
+            using const_iterator = iterator_t<const mapped_type>;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            static constexpr size_type capacity = t_capacity;
+
+            //constructors
+            static_flat_map() = default;
+            template <size_t size>
+            static_flat_map(value_type const (&arr)[size])
+            {
+                for(const value_type& v: arr)
+                    insert(v);
+            }
+            //element access
+            mapped_type& at(const key_type& key)
+            {
+                return const_cast<mapped_type&>(const_cast<const static_flat_map&>(*this).at(key));
+            }
+            const mapped_type& at(const key_type& key) const
+            {
+                size_type index = find_index(key);
+
+                if(index == size())
+                {
+                    throw std::out_of_range("accessing key not in static_flat_map");
+                }
+                return m_values[index];
+            }
+            //throws std::length_error if the key has to be inserted and the map is full
+            mapped_type& operator[](const key_type& key)
+            {
+                size_type index = lower_bound_index(key);
+
+                if(index == size() || key_compare{}(key, m_keys[index]))
+                {
+                    if(full())
+                        throw std::length_error("inserting into full static_flat_map");
+
+                    insert_at(index, key, mapped_type{});
+                }
+
+                return m_values[index];
+            }
+            //sorted keys and their values in the same order
+            const static_vector<key_type, capacity>& keys() const
+            {
+                return m_keys;
+            }
+            const static_vector<mapped_type, capacity>& values() const
+            {
+                return m_values;
+            }
+            //iterators
+            iterator begin()
+            {
+                return {this, 0};
+            }
+            const_iterator begin() const
+            {
+                return {this, 0};
+            }
+            const_iterator cbegin() const
+            {
+                return begin();
+            }
+            iterator end()
+            {
+                return {this, size()};
+            }
+            const_iterator end() const
+            {
+                return {this, size()};
+            }
+            const_iterator cend() const
+            {
+                return end();
+            }
+            reverse_iterator rbegin()
+            {
+                return reverse_iterator{end()};
+            }
+            const_reverse_iterator rbegin() const
+            {
+                return const_reverse_iterator{end()};
+            }
+            reverse_iterator rend()
+            {
+                return reverse_iterator{begin()};
+            }
+            const_reverse_iterator rend() const
+            {
+                return const_reverse_iterator{begin()};
+            }
+            //capacity
+            bool empty() const
+            {
+                return m_keys.empty();
+            }
+            size_type size() const
+            {
+                return m_keys.size();
+            }
+            bool full() const
+            {
+                return m_keys.full();
+            }
+            //modifiers
+            void clear()
+            {
+                m_keys.clear();
+                m_values.clear();
+            }
+            std::pair<iterator, bool> insert(const value_type& entry)
+            {
+                return emplace(entry.first, entry.second);
+            }
+            std::pair<iterator, bool> insert(value_type&& entry)
+            {
+                return emplace(std::move(entry.first), std::move(entry.second));
+            }
+            template <typename key_arg, typename... mapped_args>
+            std::pair<iterator, bool> emplace(key_arg&& key, mapped_args&&... args)
+            {
+                size_type index = lower_bound_index(key);
+
+                if(index != size() && !key_compare{}(key, m_keys[index]))
+                {
+                    return {begin() + index, false};
+                }
+                else if(full())
+                {
+                    return {end(), false};
+                }
+
+                insert_at(index, std::forward<key_arg>(key), std::forward<mapped_args>(args)...);
+                return {begin() + index, true};
+            }
+            iterator erase(const_iterator position)
+            {
+                return erase(position, position + 1);
+            }
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                m_keys.erase(m_keys.begin() + first.index, m_keys.begin() + last.index);
+                m_values.erase(m_values.begin() + first.index, m_values.begin() + last.index);
+
+                return {this, first.index};
+            }
+            size_type erase(const key_type& key)
+            {
+                size_type index = find_index(key);
+
+                if(index == size())
+                    return 0;
+
+                erase(begin() + index);
+                return 1;
+            }
+            //lookup
+            size_type count(const key_type& key) const
+            {
+                return static_cast<size_type>(contains(key));
+            }
+            bool contains(const key_type& key) const
+            {
+                return find_index(key) != size();
+            }
+            iterator find(const key_type& key)
+            {
+                return begin() + find_index(key);
+            }
+            const_iterator find(const key_type& key) const
+            {
+                return begin() + find_index(key);
+            }
+            iterator lower_bound(const key_type& key)
+            {
+                return begin() + lower_bound_index(key);
+            }
+            const_iterator lower_bound(const key_type& key) const
+            {
+                return begin() + lower_bound_index(key);
+            }
+            iterator upper_bound(const key_type& key)
+            {
+                return begin() + upper_bound_index(key);
+            }
+            const_iterator upper_bound(const key_type& key) const
+            {
+                return begin() + upper_bound_index(key);
+            }
+            std::pair<iterator, iterator> equal_range(const key_type& key)
+            {
+                return {lower_bound(key), upper_bound(key)};
+            }
+            std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+            {
+                return {lower_bound(key), upper_bound(key)};
+            }
+        private:
+            //binary search that halves the range with a conditional move rather than a branch,
+            //so the loop runs the same number of steps for every key and never mispredicts.
+            //returns the first index for which goes_left is true, assuming it is monotonic
+            template <typename predicate>
+            size_type partition_point(predicate goes_left) const
+            {
+                size_type length = size();
+
+                if(length == 0)
+                    return 0;
+
+                const key_type* first = m_keys.data();
+                const key_type* base = first;
+
+                while(length > 1)
+                {
+                    size_type half = length / 2;
+                    base = goes_left(base[half]) ? base : base + half;
+                    length -= half;
+                }
+
+                return static_cast<size_type>(base - first) + !goes_left(*base);
+            }
+            size_type lower_bound_index(const key_type& key) const
+            {
+                return partition_point([&key] (const key_type& current)
+                {
+                    return !key_compare{}(current, key);
+                });
+            }
+            size_type upper_bound_index(const key_type& key) const
+            {
+                return partition_point([&key] (const key_type& current)
+                {
+                    return key_compare{}(key, current);
+                });
+            }
+            //index of the key, or size() if it is not in the map
+            size_type find_index(const key_type& key) const
+            {
+                size_type index = lower_bound_index(key);
+
+                if(index != size() && key_compare{}(key, m_keys[index]))
+                    return size();
+
+                return index;
+            }
+            template <typename key_arg, typename... mapped_args>
+            void insert_at(size_type index, key_arg&& key, mapped_args&&... args)
+            {
+                m_keys.insert(m_keys.begin() + index, key_type(std::forward<key_arg>(key)));
+                m_values.insert(m_values.begin() + index, mapped_type(std::forward<mapped_args>(args)...));
+            }
+
+            static_vector<key_type, capacity> m_keys;
+            static_vector<mapped_type, capacity> m_values;
+    };
+}
@@ -1,16 +1,260 @@
 #pragma once
 #include <cstdlib>
+#include <algorithm>
 #include <array>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
 #include <stc/common.hpp>
 
+#if defined(STC_AVX2)
+#include <immintrin.h>
+#elif defined(STC_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace stc
 {
-template <typename t_key_type, typename t_mapped_type, size_t t_capacity>
-class static_map
+//probing policies for static_map
+
+//entries are placed in the first free slot after their home slot
+struct linear_probing {};
+
+//entries further from their home slot take over slots from entries closer to theirs, which
+//keeps probe lengths short and even at high load. the distance of each entry from its home
+//slot is stored alongside it so lookups can stop early
+struct robin_hood_probing {};
+
+//slots are grouped 16 at a time, and a separate array holds one control byte per slot with 7
+//bits of the hash of its key, or a marker for empty and deleted slots. lookups compare a whole
+//group of control bytes at once and only touch entries whose control byte matches, so misses
+//never leave the control bytes. erased slots become tombstones unless their group has never
+//been full. once tombstones outnumber half the empty slots the entries are rehashed in place
+//by the next insertion of a new key, or by rehash(). erasing never moves entries
+struct group_probing {};
+
+//no hashing at all. entries are kept packed at the front of the slots, and their keys, which
+//have to be integral, are copied to an aligned array that lookups compare 16 or 32 bytes at a
+//time with SSE2 or AVX2. meant for maps of at most 64 entries, where a scan is cheaper than
+//hashing. erasing moves the last entry into the hole, so it does not keep insertion order
+struct scan_probing {};
+
+//statistics policies for static_map
+
+//nothing is recorded and the map is no larger than without a policy
+struct no_stats {};
+
+//every lookup and insertion updates a static_map_stats held by the map, readable through
+//stats(). lookups on a const map update it too, so concurrent readers need their own copies
+struct collect_stats {};
+
+//layout policies for static_map
+
+//each slot holds a whole entry, key and mapped value side by side
+struct interleaved_layout {};
+
+//keys and mapped values are kept in two parallel arrays of slots, so probing only touches the
+//keys. worth it when mapped values are large. iterators hand out a pair_reference of the two
+//rather than a reference to a stored pair, so range for loops need auto or const auto&
+struct split_layout {};
+
+//hashes everything that converts to std::string_view like std::hash<std::string_view>, which
+//is also how std::hash<std::string> hashes. with std::equal_to<> as key_equal it lets maps keyed
+//by std::string or static_string be searched with string views and literals
+struct string_hash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view text) const
+    {
+        return std::hash<std::string_view>{}(text);
+    }
+};
+
+//counters of a static_map using collect_stats. copies of a map start with fresh counters
+struct static_map_stats
+{
+    //calls that searched for a key: find, contains, count, at, erase, insert and operator[]
+    size_t lookups = 0;
+    size_t hits = 0;
+    size_t misses = 0;
+    //slots, groups of slots for group_probing or blocks of keys for scan_probing, inspected
+    //over all lookups
+    size_t total_probe_length = 0;
+    size_t max_probe_length = 0;
+    //insertions of new keys refused because the map was full
+    size_t insert_failures = 0;
+    size_t peak_size = 0;
+
+    double average_probe_length() const
+    {
+        return lookups == 0 ? 0.0 : static_cast<double>(total_probe_length) / static_cast<double>(lookups);
+    }
+};
+
+//holds the counters when they are collected, and is an empty base otherwise
+template <bool t_collect>
+struct static_map_stats_holder
+{
+};
+
+template <>
+struct static_map_stats_holder<true>
+{
+    mutable static_map_stats m_stats;
+};
+
+//a group of control bytes of a group_probing static_map. the match functions return a mask
+//with one bit set per matching byte
+class control_group
+{
+    public:
+        static constexpr size_t width = 16;
+        using mask_type = uint32_t;
+
+        static constexpr int8_t empty = -128;
+        static constexpr int8_t deleted = -2;
+        //fills the last group past the end of the slots. never matches anything
+        static constexpr int8_t padding = -1;
+
+        explicit control_group(const int8_t* control)
+#if defined(STC_SSE2)
+            : m_control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control)))
+#else
+            : m_control(control)
+#endif
+        {
+        }
+
+        mask_type match(int8_t tag) const
+        {
+#if defined(STC_SSE2)
+            return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), m_control)));
+#else
+            mask_type mask = 0;
+            for(size_t i = 0; i < width; ++i)
+                mask |= static_cast<mask_type>(m_control[i] == tag) << i;
+            return mask;
+#endif
+        }
+
+        mask_type match_empty() const
+        {
+            return match(empty);
+        }
+
+        mask_type match_empty_or_deleted() const
+        {
+#if defined(STC_SSE2)
+            return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(padding), m_control)));
+#else
+            mask_type mask = 0;
+            for(size_t i = 0; i < width; ++i)
+                mask |= static_cast<mask_type>(m_control[i] < padding) << i;
+            return mask;
+#endif
+        }
+
+        mask_type match_full() const
+        {
+#if defined(STC_SSE2)
+            return static_cast<mask_type>(_mm_movemask_epi8(m_control)) ^ 0xffffu;
+#else
+            mask_type mask = 0;
+            for(size_t i = 0; i < width; ++i)
+                mask |= static_cast<mask_type>(m_control[i] >= 0) << i;
+            return mask;
+#endif
+        }
+    private:
+#if defined(STC_SSE2)
+        __m128i m_control;
+#else
+        const int8_t* m_control;
+#endif
+};
+
+//a block of keys of a scan_probing static_map. match returns a mask with one bit set per byte
+//of each key equal to the one searched for, so the first match is at the trailing zero count
+//divided by the size of a key. the keys have to be aligned to bytes
+template <typename key_type>
+class key_block
+{
+    public:
+#if defined(STC_AVX2)
+        static constexpr size_t bytes = 32;
+#else
+        static constexpr size_t bytes = 16;
+#endif
+        static constexpr size_t width = bytes / sizeof(key_type);
+        using mask_type = uint32_t;
+
+        static_assert(std::is_integral_v<key_type> && bytes % sizeof(key_type) == 0, "key_block needs integral keys");
+
+        static mask_type match(const key_type* keys, key_type key)
+        {
+#if defined(STC_AVX2)
+            __m256i block = _mm256_load_si256(reinterpret_cast<const __m256i*>(keys));
+            __m256i equal;
+
+            if constexpr(sizeof(key_type) == 1)
+                equal = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(static_cast<char>(key)));
+            else if constexpr(sizeof(key_type) == 2)
+                equal = _mm256_cmpeq_epi16(block, _mm256_set1_epi16(static_cast<short>(key)));
+            else if constexpr(sizeof(key_type) == 4)
+                equal = _mm256_cmpeq_epi32(block, _mm256_set1_epi32(static_cast<int>(key)));
+            else
+                equal = _mm256_cmpeq_epi64(block, _mm256_set1_epi64x(static_cast<long long>(key)));
+
+            return static_cast<mask_type>(_mm256_movemask_epi8(equal));
+#elif defined(STC_SSE2)
+            __m128i block = _mm_load_si128(reinterpret_cast<const __m128i*>(keys));
+            __m128i equal;
+
+            if constexpr(sizeof(key_type) == 1)
+            {
+                equal = _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(key)));
+            }
+            else if constexpr(sizeof(key_type) == 2)
+            {
+                equal = _mm_cmpeq_epi16(block, _mm_set1_epi16(static_cast<short>(key)));
+            }
+            else if constexpr(sizeof(key_type) == 4)
+            {
+                equal = _mm_cmpeq_epi32(block, _mm_set1_epi32(static_cast<int>(key)));
+            }
+            else
+            {
+                //sse2 has no 64 bit compare. both halves of a key have to be equal
+                __m128i halves = _mm_cmpeq_epi32(block, _mm_set1_epi64x(static_cast<long long>(key)));
+                equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+
+            return static_cast<mask_type>(_mm_movemask_epi8(equal));
+#else
+            mask_type mask = 0;
+            for(size_t i = 0; i < width; ++i)
+                mask |= static_cast<mask_type>(keys[i] == key) << (i * sizeof(key_type));
+            return mask;
+#endif
+        }
+};
+
+//open addressing hash map. entries live in a flat array of capacity slots and are found by
+//probing from the slot given by the hash of the key. hasher and key_equal are expected to be
+//stateless and are default constructed on use
+template <typename t_key_type, typename t_mapped_type, size_t t_capacity, typename t_hash = std::hash<t_key_type>, typename t_key_equal = std::equal_to<t_key_type>, typename t_probing = linear_probing, typename t_stats = no_stats, typename t_layout = interleaved_layout>
+class static_map: private static_map_stats_holder<std::is_same_v<t_stats, collect_stats>>
 {
     public:
         using key_type = t_key_type;
         using mapped_type = t_mapped_type;
+        using hasher = t_hash;
+        using key_equal = t_key_equal;
+        using probing = t_probing;
+        using stats_policy = t_stats;
+        using layout = t_layout;
 
         struct pair
         {
@@ -18,45 +262,255 @@ class static_map
             mapped_type second;
         };
 
+        //an entry of a split_layout map, referring to its key and mapped value where they are
+        //stored
+        template <typename mapped_reference>
+        struct pair_reference
+        {
+            operator pair() const
+            {
+                return {first, second};
+            }
+
+            const key_type& first;
+            mapped_reference second;
+        };
+
+        //what -> of a split_layout iterator returns, holding the pair_reference it points to
+        template <typename reference_type>
+        struct pair_pointer
+        {
+            const reference_type* operator->() const
+            {
+                return &target;
+            }
+
+            reference_type target;
+        };
+
+        static constexpr bool split = std::is_same_v<layout, split_layout>;
+
+        static_assert(split || std::is_same_v<layout, interleaved_layout>, "unknown layout policy");
 
         using size_type = size_t;
         using value_type = pair;
-        using reference = value_type&;
-        using const_reference = const value_type&;
-        using pointer = value_type*;
-        using const_pointer = const value_type*;
+        using reference = std::conditional_t<split, pair_reference<mapped_type&>, value_type&>;
+        using const_reference = std::conditional_t<split, pair_reference<const mapped_type&>, const value_type&>;
+        using pointer = std::conditional_t<split, pair_pointer<reference>, value_type*>;
+        using const_pointer = std::conditional_t<split, pair_pointer<const_reference>, const value_type*>;
         static constexpr size_type capacity = t_capacity;
     private:
-        using concrete_type = static_map<key_type, mapped_type, capacity>;
-        using slot_type = optional_container_storage<value_type>;
+        using concrete_type = static_map<key_type, mapped_type, capacity, hasher, key_equal, probing, stats_policy, layout>;
+        using distance_type = smallest_unsigned_t<capacity>;
+
+        static constexpr bool robin_hood = std::is_same_v<probing, robin_hood_probing>;
+        static constexpr bool grouped = std::is_same_v<probing, group_probing>;
+        static constexpr bool scanned = std::is_same_v<probing, scan_probing>;
+
+        static_assert(robin_hood || grouped || scanned || std::is_same_v<probing, linear_probing>, "unknown probing policy");
+        static_assert(!scanned || (std::is_integral_v<key_type> && capacity <= 64), "scan_probing needs integral keys and a capacity of at most 64");
+        static_assert(!scanned || std::is_same_v<key_equal, std::equal_to<key_type>> || std::is_same_v<key_equal, std::equal_to<>>, "scan_probing compares keys with ==");
+
+        static constexpr bool collecting_stats = std::is_same_v<stats_policy, collect_stats>;
+
+        //past every position in iteration order, see order_of
+        static constexpr size_t end_position = 2 * capacity;
+
+        //lookups by other types than key_type are offered when both hasher and key_equal
+        //declare is_transparent. dependent on lookup_type so that it can disable the overloads
+        template <typename lookup_type>
+        static constexpr bool transparent_for = is_transparent_v<hasher> && is_transparent_v<key_equal> && !std::is_same_v<lookup_type, key_type>;
+        template <typename lookup_type>
+        using transparent_lookup = std::enable_if_t<transparent_for<lookup_type>>;
+
+        static_assert(collecting_stats || std::is_same_v<stats_policy, no_stats>, "unknown stats policy");
+
+        using counter_type = smallest_unsigned_t<capacity>;
+
+        static constexpr size_t group_count = (capacity + control_group::width - 1) / control_group::width;
+
+        //which slots hold entries is kept apart from the slots themselves, in a bitmap or in
+        //the control bytes for grouped maps
+        struct linear_metadata
+        {
+            occupancy_bitmap<capacity> occupied;
+        };
+        struct robin_hood_metadata
+        {
+            occupancy_bitmap<capacity> occupied;
+            std::array<distance_type, capacity> distances = {};
+        };
+        struct group_metadata
+        {
+            group_metadata()
+            {
+                for(size_t i = 0; i < control.size(); ++i)
+                    control[i] = i < capacity ? control_group::empty : control_group::padding;
+            }
+
+            alignas(control_group::width) std::array<int8_t, group_count * control_group::width> control;
+            counter_type deleted = 0;
+        };
+        struct scan_metadata
+        {
+            using block = key_block<key_type>;
+
+            //padded to whole blocks so that scans never read past the end
+            alignas(block::bytes) std::array<key_type, (capacity + block::width - 1) / block::width * block::width> keys = {};
+        };
+        using metadata_type = std::conditional_t<robin_hood, robin_hood_metadata, std::conditional_t<grouped, group_metadata, std::conditional_t<scanned, scan_metadata, linear_metadata>>>;
+
+        //the slots of the entries for each layout. none of them know which slots are occupied,
+        //that is up to the map
+        struct interleaved_slots
+        {
+            const key_type& key(size_t index) const
+            {
+                return entries[index].get().first;
+            }
+
+            reference entry(size_t index)
+            {
+                return entries[index].get();
+            }
+
+            const_reference entry(size_t index) const
+            {
+                return entries[index].get();
+            }
+
+            void construct(size_t index, value_type&& entry)
+            {
+                entries[index].set(std::move(entry));
+            }
+
+            void construct(size_t index, const value_type& entry)
+            {
+                entries[index].set(entry);
+            }
+
+            void construct(size_t index, interleaved_slots& from, size_t from_index)
+            {
+                entries[index].set(std::move(from.entries[from_index].get()));
+            }
+
+            void destroy(size_t index)
+            {
+                entries[index].destroy();
+            }
+
+            void swap(size_t index, value_type& entry)
+            {
+                std::swap(entries[index].get(), entry);
+            }
+
+            void swap(size_t index, size_t other)
+            {
+                std::swap(entries[index].get(), entries[other].get());
+            }
+
+            std::array<container_storage<value_type>, capacity> entries;
+        };
+
+        struct split_slots
+        {
+            const key_type& key(size_t index) const
+            {
+                return keys[index].get();
+            }
+
+            reference entry(size_t index)
+            {
+                return {keys[index].get(), values[index].get()};
+            }
+
+            const_reference entry(size_t index) const
+            {
+                return {keys[index].get(), values[index].get()};
+            }
+
+            void construct(size_t index, value_type&& entry)
+            {
+                keys[index].set(std::move(entry.first));
+                values[index].set(std::move(entry.second));
+            }
+
+            void construct(size_t index, const value_type& entry)
+            {
+                keys[index].set(entry.first);
+                values[index].set(entry.second);
+            }
+
+            void construct(size_t index, split_slots& from, size_t from_index)
+            {
+                keys[index].set(std::move(from.keys[from_index].get()));
+                values[index].set(std::move(from.values[from_index].get()));
+            }
+
+            void destroy(size_t index)
+            {
+                keys[index].destroy();
+                values[index].destroy();
+            }
+
+            void swap(size_t index, value_type& entry)
+            {
+                std::swap(keys[index].get(), entry.first);
+                std::swap(values[index].get(), entry.second);
+            }
+
+            void swap(size_t index, size_t other)
+            {
+                std::swap(keys[index].get(), keys[other].get());
+                std::swap(values[index].get(), values[other].get());
+            }
+
+            std::array<container_storage<key_type>, capacity> keys;
+            std::array<container_storage<mapped_type>, capacity> values;
+        };
+        using slots_type = std::conditional_t<split, split_slots, interleaved_slots>;
+
+        struct probe_result
+        {
+            //slot holding the key if found, otherwise the slot where it would be inserted
+            size_t index;
+            bool found;
+            //number of slots, groups for group_probing or blocks of keys for scan_probing,
+            //inspected
+            size_t length;
+            size_t hash;
+        };
     public:
 
         template<typename value_type>
         struct iterator_t
         {
+            using map_pointer = std::conditional_t<std::is_const_v<value_type>, const concrete_type*, concrete_type*>;
+            using reference = std::conditional_t<std::is_const_v<value_type>, typename concrete_type::const_reference, typename concrete_type::reference>;
+            using pointer = std::conditional_t<std::is_const_v<value_type>, typename concrete_type::const_pointer, typename concrete_type::pointer>;
+
             iterator_t& operator++ ()
             {
-                do
-                {
-                    ++target;
-                }while(target < end && !target->has_value);
-
+                position = map->next_in_order(position + 1);
                 return *this;
             }
 
-            value_type& operator *() const
+            reference operator *() const
             {
-                return target->get();
+                return map->m_slots.entry(slot_of(position));
             }
 
-            value_type* operator->() const
+            pointer operator->() const
             {
-                return &target->get();
+                if constexpr(split)
+                    return {**this};
+                else
+                    return &**this;
             }
 
             bool operator==(const iterator_t& other) const
             {
-                return target == other.target && end == other.end;
+                return map == other.map && position == other.position;
             }
 
             bool operator!=(const iterator_t& other) const
@@ -64,8 +518,9 @@ class static_map
                 return !(*this == other);
             }
 
-            slot_type* target = nullptr;
-            slot_type* end = nullptr;
+            map_pointer map = nullptr;
+            //place in iteration order, see order_of
+            size_t position = 0;
         };
 
         using iterator = iterator_t<value_type>;
@@ -78,58 +533,97 @@ class static_map
             for(const value_type& v: arr)
                 insert(v);
         }
+        static_map(const static_map& other):
+            m_size(other.m_size),
+            m_metadata(other.m_metadata)
+        {
+            for(size_t i = other.next_occupied(0); i < capacity; i = other.next_occupied(i + 1))
+                construct_slot(i, other.m_slots.entry(i));
+        }
+        static_map(static_map&& other):
+            m_size(other.m_size),
+            m_metadata(other.m_metadata)
+        {
+            for(size_t i = other.next_occupied(0); i < capacity; i = other.next_occupied(i + 1))
+                construct_slot(i, other.m_slots, i);
 
-        std::pair<iterator, bool> insert(value_type entry)
+            other.clear();
+        }
+        ~static_map()
+        {
+            destroy();
+        }
+        static_map& operator=(const static_map& other)
         {
-            iterator existing = find(entry.first);
+            if(&other == this)
+                return *this;
 
-            if(existing != end())
-            {
-                return {existing, false};
-            }
-            else
-            {
-                size_t target = find_next_empty_slot();
+            clear();
 
-                if(target != m_storage.size())
-                {
-                    slot_type& slot = m_storage[target];
-                    slot = slot_type{std::move(entry)};
-                    ++m_size;
-                    return { {&slot, m_storage.data() + m_storage.size()}, true };
-                }
-                else
-                {
-                    //full. assert?
-                    return {end(), false};
-                }
-            }
-        }
+            m_size = other.m_size;
+            m_metadata = other.m_metadata;
+
+            for(size_t i = other.next_occupied(0); i < capacity; i = other.next_occupied(i + 1))
+                construct_slot(i, other.m_slots.entry(i));
 
-        mapped_type& operator[] (key_type key)
+            return *this;
+        }
+        static_map& operator=(static_map&& other)
         {
-            iterator existing = find(key);
+            if(&other == this)
+                return *this;
+
+            clear();
+
+            m_size = other.m_size;
+            m_metadata = other.m_metadata;
+
+            for(size_t i = other.next_occupied(0); i < capacity; i = other.next_occupied(i + 1))
+                construct_slot(i, other.m_slots, i);
+
+            other.clear();
 
+            return *this;
+        }
+
+        std::pair<iterator, bool> insert(value_type entry)
+        {
+            probe_result probed = probe(entry.first);
+            record_lookup(probed);
 
-            if(existing != end())
+            if(probed.found)
             {
-                return existing->second;
+                return {iterator_at(probed.index), false};
+            }
+            else if(full())
+            {
+                record_insert_failure();
+                return {end(), false};
             }
             else
             {
-                size_t target = find_next_empty_slot();
+                size_t index = insert_at(probed, std::move(entry));
+                record_size();
+                return {iterator_at(index), true};
+            }
+        }
 
-                if(target == m_storage.size())
-                {
-                    //full. assert?
-                }
+        //throws std::length_error if the key has to be inserted and the map is full
+        mapped_type& operator[] (const key_type& key)
+        {
+            return subscript(key);
+        }
 
-                slot_type& slot = m_storage[target];
-                slot = slot_type{{key, mapped_type{}}};
-                ++m_size;
+        mapped_type& operator[] (key_type&& key)
+        {
+            return subscript(std::move(key));
+        }
 
-                return slot.get().second;
-            }
+        //the key is only constructed from lookup_key if it has to be inserted
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        mapped_type& operator[] (const lookup_type& key)
+        {
+            return subscript(key);
         }
 
         const mapped_type& operator[] (const key_type& key) const
@@ -148,42 +642,51 @@ class static_map
             return found->second;
         }
 
-        iterator erase(const key_type& key)
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        mapped_type& at(const lookup_type& key)
         {
-            iterator found = find(key);
-
-            if(found != end())
-            {
-                size_t index = std::distance(m_storage.data(), found.target); 
+            return find(key)->second;
+        }
 
-                m_storage[index] = {};
-                --m_size;
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        const mapped_type& at(const lookup_type& key) const
+        {
+            return find(key)->second;
+        }
 
-                return ++found;
-            }
+        iterator erase(const key_type& key)
+        {
+            return erase_key(key);
+        }
 
-            return found;
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        iterator erase(const lookup_type& key)
+        {
+            return erase_key(key);
         }
 
         iterator find(const key_type& key)
         {
-            iterator end_iter = end();
-
-            for(iterator iter = begin(); iter != end_iter; ++iter)
-            {
-                if(iter->first == key)
-                {
-                    return iter;
-                }
-            }
-
-            return end_iter;
+            return find_key(key);
         }
 
         const_iterator find(const key_type& key) const
         {
             iterator found = const_cast<concrete_type*>(this)->find(key);
-            return const_iterator{found.target, found.end};
+            return const_iterator{found.map, found.position};
+        }
+
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        iterator find(const lookup_type& key)
+        {
+            return find_key(key);
+        }
+
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        const_iterator find(const lookup_type& key) const
+        {
+            iterator found = const_cast<concrete_type*>(this)->find_key(key);
+            return const_iterator{found.map, found.position};
         }
 
         bool contains(const key_type& key) const
@@ -191,17 +694,60 @@ class static_map
             return find(key) != end();
         }
 
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        bool contains(const lookup_type& key) const
+        {
+            return find(key) != end();
+        }
+
         size_t count(const key_type& key) const
         {
             return static_cast<size_t>(contains(key));
         }
 
+        template <typename lookup_type, typename = transparent_lookup<lookup_type>>
+        size_t count(const lookup_type& key) const
+        {
+            return static_cast<size_t>(contains(key));
+        }
+
+        //number of slots, groups of slots for group_probing or blocks of keys for scan_probing,
+        //a lookup of key inspects, whether or not the key is present
+        size_t probe_length(const key_type& key) const
+        {
+            return probe(key).length;
+        }
+
+        //counters recorded since construction or the last reset_stats(). needs collect_stats
+        const static_map_stats& stats() const
+        {
+            static_assert(collecting_stats, "stats() needs a static_map using collect_stats");
+            return this->m_stats;
+        }
+
+        void reset_stats()
+        {
+            static_assert(collecting_stats, "reset_stats() needs a static_map using collect_stats");
+            this->m_stats = static_map_stats{};
+            this->m_stats.peak_size = m_size;
+        }
+
         void clear()
         {
-            m_storage.fill({});
+            destroy();
+            m_metadata = metadata_type{};
             m_size = 0;
         }
 
+        //drops the tombstones of a group_probing map, rehashing its entries in place. this
+        //otherwise waits for an insertion, see group_probing. invalidates iterators. maps using
+        //other probing policies have no tombstones
+        void rehash()
+        {
+            if constexpr(grouped)
+                drop_tombstones();
+        }
+
         size_t size() const
         {
             return m_size;
@@ -214,63 +760,585 @@ class static_map
 
         bool full() const
         {
-            return m_size == m_storage.size();
+            return m_size == capacity;
         }
 
         iterator begin()
         {
-            iterator result;
-            result.target = m_storage.data() + m_storage.size();
-            result.end = m_storage.data() + m_storage.size();
+            return {this, next_in_order(0)};
+        }
+
+        const_iterator begin() const
+        {
+            iterator iter = const_cast<concrete_type*>(this)->begin();
+            return const_iterator{iter.map, iter.position};
+        }
+
+        iterator end()
+        {
+            return {this, end_position};
+        }
+
+        const_iterator end() const
+        {
+            iterator iter = const_cast<concrete_type*>(this)->end();
+            return const_iterator{iter.map, iter.position};
+        }
+    private:
+        template <typename lookup_type>
+        static size_t hash_key(const lookup_type& key)
+        {
+            size_t hash = hasher{}(key);
 
-            for(auto& entry : m_storage)
+            //the control bytes and the group both come from the hash, so make sure all its
+            //bits are mixed since std::hash is often the identity
+            if constexpr(grouped)
             {
-                if(entry.has_value)
+                uint64_t mixed = static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+                hash = static_cast<size_t>(mixed ^ (mixed >> 32));
+            }
+
+            return hash;
+        }
+
+        static size_t home_index(size_t hash)
+        {
+            return hash % capacity;
+        }
+
+        static size_t next_index(size_t index)
+        {
+            return index + 1 == capacity ? 0 : index + 1;
+        }
+
+        static size_t distance_from_home(size_t index, size_t home)
+        {
+            return index >= home ? index - home : index + capacity - home;
+        }
+
+        static int8_t control_tag(size_t hash)
+        {
+            return static_cast<int8_t>(hash & 0x7f);
+        }
+
+        static size_t home_group(size_t hash)
+        {
+            return (hash >> 7) % group_count;
+        }
+
+        bool occupied(size_t index) const
+        {
+            if constexpr(grouped)
+                return m_metadata.control[index] >= 0;
+            else if constexpr(scanned)
+                return index < m_size;
+            else
+                return m_metadata.occupied.test(index);
+        }
+
+        //first occupied slot at or after index, or capacity if there is none
+        size_t next_occupied(size_t index) const
+        {
+            if constexpr(grouped)
+            {
+                while(index < capacity)
                 {
-                    result.target = &entry;
-                    break;
+                    size_t group_start = index - index % control_group::width;
+                    control_group::mask_type mask = control_group(&m_metadata.control[group_start]).match_full() >> (index - group_start);
+
+                    if(mask != 0)
+                        return index + count_trailing_zeros(mask);
+
+                    index = group_start + control_group::width;
                 }
+
+                return capacity;
+            }
+            else if constexpr(scanned)
+            {
+                return index < m_size ? index : capacity;
             }
+            else
+            {
+                return m_metadata.occupied.find_next_set(index);
+            }
+        }
 
-            return result;
+        //true for entries whose probe chain wrapped around from the last slot to the first ones
+        bool wrapped(size_t index) const
+        {
+            if constexpr(grouped || scanned)
+            {
+                return false;
+            }
+            else if constexpr(robin_hood)
+            {
+                return occupied(index) && m_metadata.distances[index] > index;
+            }
+            else
+            {
+                //such an entry is in a run of occupied slots going through the last slot
+                if(!occupied(capacity - 1) || (index > 0 && !occupied(index - 1)))
+                    return false;
+
+                return home_index(hash_key(m_slots.key(index))) > index;
+            }
         }
 
-        const_iterator begin() const
+        //iteration goes through the slots in order, but entries whose probe chain wrapped are
+        //visited after all others, as if they were in slots past the last one. backward shift
+        //deletion only ever moves entries back along their chain, so in this order it never
+        //moves an entry from before an iterator to after it or the other way round
+        size_t order_of(size_t index) const
         {
-            iterator iter = const_cast<concrete_type*>(this)->begin();
-            return const_iterator{iter.target, iter.end};
+            return wrapped(index) ? index + capacity : index;
         }
 
-        iterator end()
+        static size_t slot_of(size_t position)
         {
-            iterator result;
-            result.target = m_storage.data() + m_storage.size();
-            result.end = m_storage.data() + m_storage.size();
+            return position < capacity ? position : position - capacity;
+        }
+
+        //first position at or after position that holds an entry, or end_position
+        size_t next_in_order(size_t position) const
+        {
+            if(position < capacity)
+            {
+                for(size_t index = next_occupied(position); index < capacity; index = next_occupied(index + 1))
+                {
+                    if(!wrapped(index))
+                        return index;
+                }
+
+                position = capacity;
+            }
 
-            return result;
+            //wrapped entries are all in the run of occupied slots starting at the first slot
+            for(size_t index = position - capacity; index < capacity && occupied(index); ++index)
+            {
+                if(wrapped(index))
+                    return index + capacity;
+            }
+
+            return end_position;
         }
 
-        const_iterator end() const
+        template <typename... Args>
+        void construct_slot(size_t index, Args&&... args)
         {
-            iterator iter = const_cast<concrete_type*>(this)->end();
-            return const_iterator{iter.target, iter.end};
+            m_slots.construct(index, std::forward<Args>(args)...);
+
+            if constexpr(!grouped && !scanned)
+                m_metadata.occupied.set(index);
         }
-    private:
-        size_t find_next_empty_slot() const
+
+        void destroy_slot(size_t index)
+        {
+            m_slots.destroy(index);
+
+            if constexpr(grouped)
+            {
+                //a group that has an empty slot was never full, so no probe chain continues
+                //past it and the slot can be freed entirely
+                size_t group_start = index - index % control_group::width;
+                bool was_never_full = control_group(&m_metadata.control[group_start]).match_empty() != 0;
+
+                if(was_never_full)
+                {
+                    m_metadata.control[index] = control_group::empty;
+                }
+                else
+                {
+                    m_metadata.control[index] = control_group::deleted;
+                    ++m_metadata.deleted;
+                }
+            }
+            else if constexpr(!scanned)
+            {
+                m_metadata.occupied.reset(index);
+            }
+        }
+
+        void move_slot(size_t from, size_t to)
+        {
+            construct_slot(to, m_slots, from);
+            destroy_slot(from);
+        }
+
+        //destroys all entries without updating the metadata
+        void destroy()
+        {
+            for(size_t i = next_occupied(0); i < capacity; i = next_occupied(i + 1))
+                m_slots.destroy(i);
+        }
+
+        template <typename lookup_type>
+        iterator find_key(const lookup_type& key)
+        {
+            probe_result probed = probe(key);
+            record_lookup(probed);
+
+            if(!probed.found)
+                return end();
+
+            return iterator_at(probed.index);
+        }
+
+        template <typename lookup_type>
+        iterator erase_key(const lookup_type& key)
+        {
+            iterator found = find_key(key);
+
+            if(found != end())
+            {
+                size_t index = slot_of(found.position);
+
+                destroy_slot(index);
+                --m_size;
+                close_gap(index);
+
+                //entries further down the probe chain may have been shifted back as far as
+                //the erased position, but entries already visited stay before it
+                return {this, next_in_order(found.position)};
+            }
+
+            return found;
+        }
+
+        template <typename lookup_type>
+        mapped_type& subscript(lookup_type&& key)
+        {
+            probe_result probed = probe(key);
+            record_lookup(probed);
+
+            if(!probed.found)
+            {
+                if(full())
+                {
+                    record_insert_failure();
+                    throw std::length_error("inserting into full static_map");
+                }
+
+                size_t index = insert_at(probed, {key_type(std::forward<lookup_type>(key)), mapped_type{}});
+                record_size();
+                return m_slots.entry(index).second;
+            }
+
+            return m_slots.entry(probed.index).second;
+        }
+
+        void record_lookup(const probe_result& probed) const
+        {
+            if constexpr(collecting_stats)
+            {
+                static_map_stats& stats = this->m_stats;
+
+                ++stats.lookups;
+                ++(probed.found ? stats.hits : stats.misses);
+                stats.total_probe_length += probed.length;
+                stats.max_probe_length = std::max(stats.max_probe_length, probed.length);
+            }
+        }
+
+        void record_insert_failure() const
+        {
+            if constexpr(collecting_stats)
+                ++this->m_stats.insert_failures;
+        }
+
+        void record_size() const
+        {
+            if constexpr(collecting_stats)
+                this->m_stats.peak_size = std::max<size_t>(this->m_stats.peak_size, m_size);
+        }
+
+        template <typename lookup_type>
+        probe_result probe(const lookup_type& key) const
         {
-            for(size_t i = 0; i < m_storage.size(); ++i)
+            if constexpr(scanned)
             {
-                if(!m_storage[i].has_value)
+                static_assert(std::is_same_v<lookup_type, key_type>, "scan_probing maps are only searched by key_type");
+
+                using block = typename scan_metadata::block;
+                size_t blocks = 0;
+
+                for(size_t start = 0; start < m_size; start += block::width)
                 {
-                    return i;
+                    ++blocks;
+                    typename block::mask_type mask = block::match(&m_metadata.keys[start], key);
+
+                    if(mask != 0)
+                    {
+                        //keys past the size are left over from erased entries
+                        size_t index = start + count_trailing_zeros(mask) / sizeof(key_type);
+
+                        if(index < m_size)
+                            return {index, true, blocks, 0};
+
+                        break;
+                    }
                 }
+
+                return {m_size, false, blocks, 0};
             }
 
-            return m_storage.size();
+            size_t hash = hash_key(key);
+
+            if constexpr(grouped)
+            {
+                int8_t tag = control_tag(hash);
+                size_t group = home_group(hash);
+                size_t insert_index = capacity;
+
+                for(size_t probed = 1; probed <= group_count; ++probed)
+                {
+                    size_t group_start = group * control_group::width;
+                    control_group control(&m_metadata.control[group_start]);
+
+                    for(control_group::mask_type mask = control.match(tag); mask != 0; mask &= mask - 1)
+                    {
+                        size_t index = group_start + count_trailing_zeros(mask);
+
+                        if(key_equal{}(m_slots.key(index), key))
+                            return {index, true, probed, hash};
+                    }
+
+                    if(insert_index == capacity)
+                    {
+                        control_group::mask_type free = control.match_empty_or_deleted();
+
+                        if(free != 0)
+                            insert_index = group_start + count_trailing_zeros(free);
+                    }
+
+                    //the key would have been placed in this group had it been inserted
+                    if(control.match_empty() != 0)
+                        return {insert_index, false, probed, hash};
+
+                    group = group + 1 == group_count ? 0 : group + 1;
+                }
+
+                return {insert_index, false, group_count, hash};
+            }
+            else
+            {
+                size_t index = home_index(hash);
+
+                for(size_t distance = 0; distance < capacity; ++distance)
+                {
+                    if(!occupied(index))
+                        return {index, false, distance + 1, hash};
+
+                    //an entry closer to its home than we are to ours would have been displaced
+                    if constexpr(robin_hood)
+                    {
+                        if(m_metadata.distances[index] < distance)
+                            return {index, false, distance + 1, hash};
+                    }
+
+                    if(key_equal{}(m_slots.key(index), key))
+                        return {index, true, distance + 1, hash};
+
+                    index = next_index(index);
+                }
+
+                return {capacity, false, capacity, hash};
+            }
+        }
+
+        //places an entry with a key not yet in the map at the slot its probe ended on, or in
+        //the first free slot of its probe sequence if tombstones were dropped first. returns
+        //the slot the entry ended up in
+        size_t insert_at(const probe_result& probed, value_type&& entry)
+        {
+            size_t target = probed.index;
+
+            if constexpr(grouped)
+            {
+                //lookups only stop at empty slots, so without this misses end up visiting every
+                //group once tombstones have replaced all empty slots. done here rather than in
+                //erase since inserting invalidates iterators anyway
+                if(m_metadata.deleted > (capacity - m_size) / 2)
+                {
+                    drop_tombstones();
+                    target = find_free_slot(probed.hash);
+                }
+            }
+
+            size_t index = target;
+
+            if constexpr(robin_hood)
+            {
+                size_t distance = distance_from_home(index, home_index(probed.hash));
+
+                //the new entry always lands at index. whatever it displaces is carried further
+                //down the chain, taking over the slot of any entry closer to its home
+                while(occupied(index))
+                {
+                    distance_type& slot_distance = m_metadata.distances[index];
+
+                    if(slot_distance < distance)
+                    {
+                        m_slots.swap(index, entry);
+
+                        size_t displaced_distance = slot_distance;
+                        slot_distance = static_cast<distance_type>(distance);
+                        distance = displaced_distance;
+                    }
+
+                    index = next_index(index);
+                    ++distance;
+                }
+
+                m_metadata.distances[index] = static_cast<distance_type>(distance);
+            }
+            else if constexpr(grouped)
+            {
+                if(m_metadata.control[index] == control_group::deleted)
+                    --m_metadata.deleted;
+
+                m_metadata.control[index] = control_tag(probed.hash);
+            }
+            else if constexpr(scanned)
+            {
+                m_metadata.keys[index] = entry.first;
+            }
+
+            construct_slot(index, std::move(entry));
+            ++m_size;
+
+            return target;
+        }
+
+        //backward shift deletion. moves entries following the now empty slot back into it as
+        //long as that keeps them reachable from their home slot, so no tombstones are needed.
+        //group_probing maps keep their tombstones until the next insertion instead, since
+        //dropping them moves entries past iterators
+        void close_gap(size_t gap)
+        {
+            if constexpr(scanned)
+            {
+                //the last entry takes over the slot to keep the entries packed. the size has
+                //already been lowered, so it is the index of that entry
+                if(gap != m_size)
+                {
+                    move_slot(m_size, gap);
+                    m_metadata.keys[gap] = m_metadata.keys[m_size];
+                }
+            }
+            else if constexpr(!grouped)
+            {
+                size_t current = next_index(gap);
+
+                while(occupied(current))
+                {
+                    if constexpr(robin_hood)
+                    {
+                        //chains are ordered by distance, so the shift ends at the first entry
+                        //already in its home slot
+                        distance_type distance = m_metadata.distances[current];
+
+                        if(distance == 0)
+                            break;
+
+                        move_slot(current, gap);
+                        m_metadata.distances[gap] = static_cast<distance_type>(distance - 1);
+                        gap = current;
+                    }
+                    else
+                    {
+                        size_t home = home_index(hash_key(m_slots.key(current)));
+
+                        bool reachable_without_gap = gap <= current ?
+                            (gap < home && home <= current) :
+                            (gap < home || home <= current);
+
+                        if(!reachable_without_gap)
+                        {
+                            move_slot(current, gap);
+                            gap = current;
+                        }
+                    }
+
+                    current = next_index(current);
+                }
+            }
+        }
+
+        //first empty or deleted slot in the probe sequence of a hash
+        size_t find_free_slot(size_t hash) const
+        {
+            size_t group = home_group(hash);
+
+            for(size_t probed = 0; probed < group_count; ++probed)
+            {
+                size_t group_start = group * control_group::width;
+                control_group::mask_type free = control_group(&m_metadata.control[group_start]).match_empty_or_deleted();
+
+                if(free != 0)
+                    return group_start + count_trailing_zeros(free);
+
+                group = group + 1 == group_count ? 0 : group + 1;
+            }
+
+            return capacity;
+        }
+
+        //rehashes all entries in place, turning every tombstone back into an empty slot. all
+        //entries are first marked as deleted, then each is moved to the first free slot of its
+        //probe sequence, swapping places with entries not yet visited
+        void drop_tombstones()
+        {
+            for(size_t i = 0; i < capacity; ++i)
+            {
+                int8_t& control = m_metadata.control[i];
+                control = control >= 0 ? control_group::deleted : control_group::empty;
+            }
+
+            for(size_t i = 0; i < capacity;)
+            {
+                if(m_metadata.control[i] != control_group::deleted)
+                {
+                    ++i;
+                    continue;
+                }
+
+                size_t hash = hash_key(m_slots.key(i));
+                size_t target = find_free_slot(hash);
+
+                if(target / control_group::width == i / control_group::width)
+                {
+                    m_metadata.control[i] = control_tag(hash);
+                    ++i;
+                }
+                else if(m_metadata.control[target] == control_group::empty)
+                {
+                    m_metadata.control[target] = control_tag(hash);
+                    m_metadata.control[i] = control_group::empty;
+                    m_slots.construct(target, m_slots, i);
+                    m_slots.destroy(i);
+                    ++i;
+                }
+                else
+                {
+                    //target holds an entry not yet placed. it takes this slot and is placed next
+                    m_metadata.control[target] = control_tag(hash);
+                    m_slots.swap(target, i);
+                }
+            }
+
+            m_metadata.deleted = 0;
+        }
+
+        iterator iterator_at(size_t index)
+        {
+            return {this, order_of(index)};
         }
 
-        size_t m_size = 0;
-        std::array<slot_type, capacity> m_storage;
+        slots_type m_slots;
+        //between the slots and the metadata, where small counters fit in alignment padding
+        counter_type m_size = 0;
+        metadata_type m_metadata;
 };
 
 template<typename key_type, typename value_type, size_t capacity>
@@ -0,0 +1,189 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    //bounded lock free queue for any number of producer and consumer threads, after dmitry
+    //vyukov's design. every slot carries a sequence number telling which push or pop may use it
+    //next: a slot is free for the push at position p when its sequence is p, and holds that
+    //push's element for the pop at position p when it is p + 1. the pop then sets it to p plus
+    //the capacity, handing it to the push one lap later. threads claim a position by a compare
+    //exchange on the shared push or pop counter and afterwards only touch their own slot, so a
+    //slow thread never blocks the others from claiming the slots after it. the two counters
+    //are kept on separate cache lines
+    template <typename t_data, size_t t_capacity>
+    class static_mpmc_queue
+    {
+        public:
+            using value_type = t_data;
+            using size_type = size_t;
+
+            //with one slot the sequence a push leaves behind, p + 1, is also the one marking the
+            //slot free for the next push, so a full queue would look empty to producers
+            static_assert(t_capacity >= 2, "static_mpmc_queue needs a capacity of at least 2");
+
+            //constructors
+            static_mpmc_queue()
+            {
+                for(size_type i = 0; i < t_capacity; ++i)
+                    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            static_mpmc_queue(const static_mpmc_queue&) = delete;
+            static_mpmc_queue(static_mpmc_queue&&) = delete;
+            //destructor
+            ~static_mpmc_queue()
+            {
+                size_type tail = m_tail.load(std::memory_order_relaxed);
+                for(size_type i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+                    m_slots[slot(i)].storage.destroy();
+            }
+            //assignment
+            static_mpmc_queue& operator=(const static_mpmc_queue&) = delete;
+            static_mpmc_queue& operator=(static_mpmc_queue&&) = delete;
+            //producers. the try versions return false when the queue is full, the others wait
+            //for a free slot
+            bool try_push(const value_type& value)
+            {
+                return try_emplace(value);
+            }
+            bool try_push(value_type&& value)
+            {
+                return try_emplace(std::move(value));
+            }
+            //args are only used if there is a free slot
+            template <typename ...Args>
+            bool try_emplace(Args&&... args)
+            {
+                size_type position = m_tail.load(std::memory_order_relaxed);
+
+                while(true)
+                {
+                    slot_type& claimed = m_slots[slot(position)];
+                    //signed so that the comparison survives the counters wrapping
+                    std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(claimed.sequence.load(std::memory_order_acquire) - position);
+
+                    if(lag == 0)
+                    {
+                        if(m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            claimed.storage.set(std::forward<Args>(args)...);
+                            claimed.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if(lag < 0)
+                    {
+                        //not yet popped since the last lap
+                        return false;
+                    }
+                    else
+                    {
+                        //another producer took this position
+                        position = m_tail.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+            void push(const value_type& value)
+            {
+                wait_until([&]() { return try_emplace(value); });
+            }
+            void push(value_type&& value)
+            {
+                wait_until([&]() { return try_emplace(std::move(value)); });
+            }
+            template <typename ...Args>
+            void emplace(Args&&... args)
+            {
+                wait_until([&]() { return try_emplace(std::forward<Args>(args)...); });
+            }
+            //consumers. the try version returns false when the queue is empty, the other waits
+            //for an element
+            bool try_pop(value_type& value)
+            {
+                size_type position = m_head.load(std::memory_order_relaxed);
+
+                while(true)
+                {
+                    slot_type& claimed = m_slots[slot(position)];
+                    std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(claimed.sequence.load(std::memory_order_acquire) - (position + 1));
+
+                    if(lag == 0)
+                    {
+                        if(m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            value = std::move(claimed.storage.get());
+                            claimed.storage.destroy();
+                            claimed.sequence.store(position + t_capacity, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if(lag < 0)
+                    {
+                        //not yet pushed
+                        return false;
+                    }
+                    else
+                    {
+                        //another consumer took this position
+                        position = m_head.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+            void pop(value_type& value)
+            {
+                wait_until([&]() { return try_pop(value); });
+            }
+            //capacity. approximate while other threads are pushing or popping
+            bool empty() const
+            {
+                return size() == 0;
+            }
+            size_type size() const
+            {
+                size_type head = m_head.load(std::memory_order_acquire);
+                size_type tail = m_tail.load(std::memory_order_acquire);
+                return tail > head ? tail - head : 0;
+            }
+            constexpr static size_type capacity()
+            {
+                return t_capacity;
+            }
+        private:
+            struct slot_type
+            {
+                std::atomic<size_type> sequence;
+                container_storage<value_type> storage;
+            };
+
+            static constexpr bool power_of_two = (t_capacity & (t_capacity - 1)) == 0;
+
+            static size_type slot(size_type position)
+            {
+                if constexpr(power_of_two)
+                    return position & (t_capacity - 1);
+                else
+                    return position % t_capacity;
+            }
+            //spins for a while before giving the cpu away, since a full or empty queue usually
+            //only lasts until another thread gets to run
+            template <typename attempt_type>
+            static void wait_until(attempt_type&& attempt)
+            {
+                for(size_type spins = 0; !attempt(); ++spins)
+                {
+                    if(spins >= 64)
+                        std::this_thread::yield();
+                }
+            }
+
+            alignas(cache_line_size) std::atomic<size_type> m_tail = 0;
+            alignas(cache_line_size) std::atomic<size_type> m_head = 0;
+            alignas(cache_line_size) std::array<slot_type, t_capacity> m_slots;
+    };
+}
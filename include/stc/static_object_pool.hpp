@@ -0,0 +1,153 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    //fixed number of slots for objects of one type, created and destroyed one at a time in
+    //any order without moving the others. a free slot stores the index of the next free one in
+    //place of the object, so the free list needs no memory of its own, and slots never used
+    //yet are taken in order. creating and destroying are O(1). which slots hold objects is
+    //kept in a bitmap, so that objects still alive are destroyed with the pool. freed slots
+    //are poisoned as described in common.hpp
+    template <typename t_data, size_t t_capacity>
+    class static_object_pool
+    {
+        public:
+            using value_type = t_data;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using size_type = size_t;
+
+            static_assert(t_capacity > 0, "static_object_pool needs a capacity");
+
+            //constructors
+            static_object_pool()
+            {
+                mark_memory_unaddressable(m_slots.data(), sizeof(m_slots));
+            }
+            static_object_pool(const static_object_pool&) = delete;
+            static_object_pool(static_object_pool&&) = delete;
+            //destructor
+            ~static_object_pool()
+            {
+                if constexpr(!std::is_trivially_destructible_v<value_type>)
+                {
+                    for(size_t i = m_live.find_next_set(0); i < t_capacity; i = m_live.find_next_set(i + 1))
+                        m_slots[i].storage.destroy();
+                }
+
+                //the slots may be stack memory that is used for other things next
+                mark_memory_addressable(m_slots.data(), sizeof(m_slots));
+            }
+            //assignment
+            static_object_pool& operator=(const static_object_pool&) = delete;
+            static_object_pool& operator=(static_object_pool&&) = delete;
+            //modifiers. returns nullptr when every slot is taken
+            template <typename ...Args>
+            pointer create(Args&&... args)
+            {
+                counter_type index;
+
+                if(m_free_head != none)
+                {
+                    index = m_free_head;
+                    mark_memory_addressable(&m_slots[index], sizeof(slot_type));
+                    m_free_head = m_slots[index].next;
+                }
+                else if(m_unused < t_capacity)
+                {
+                    index = m_unused++;
+                    mark_memory_addressable(&m_slots[index], sizeof(slot_type));
+                }
+                else
+                {
+                    return nullptr;
+                }
+
+                slot_type& slot = m_slots[index];
+                ::new(static_cast<void*>(&slot.storage)) container_storage<value_type>;
+                slot.storage.set(std::forward<Args>(args)...);
+                m_live.set(index);
+                ++m_size;
+
+                return &slot.storage.get();
+            }
+            //object has to come from create on this pool
+            void destroy(pointer object)
+            {
+                size_t index = index_of(object);
+                //ASSERT(m_live.test(index), "destroying an object that is not alive in static object pool");
+
+                slot_type& slot = m_slots[index];
+                slot.storage.destroy();
+                m_live.reset(index);
+                --m_size;
+
+                fill_freed_memory(&slot, sizeof(slot_type));
+                slot.next = m_free_head;
+                m_free_head = static_cast<counter_type>(index);
+                mark_memory_unaddressable(&slot, sizeof(slot_type));
+            }
+            //lookup
+            bool owns(const_pointer object) const
+            {
+                const unsigned char* address = reinterpret_cast<const unsigned char*>(object);
+                const unsigned char* first = reinterpret_cast<const unsigned char*>(m_slots.data());
+
+                if(address < first || address >= first + sizeof(m_slots))
+                    return false;
+
+                size_t offset = static_cast<size_t>(address - first);
+                return offset % sizeof(slot_type) == 0 && m_live.test(offset / sizeof(slot_type));
+            }
+            //capacity
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+            size_type size() const
+            {
+                return m_size;
+            }
+            constexpr static size_type capacity()
+            {
+                return t_capacity;
+            }
+            bool full() const
+            {
+                return m_size == t_capacity;
+            }
+        private:
+            //one more than the capacity needs, to have a value for the end of the free list
+            using counter_type = smallest_unsigned_t<t_capacity + 1>;
+
+            static constexpr counter_type none = static_cast<counter_type>(t_capacity);
+
+            union slot_type
+            {
+                slot_type() {}
+                ~slot_type() {}
+
+                container_storage<value_type> storage;
+                counter_type next;
+            };
+
+            size_t index_of(const_pointer object) const
+            {
+                const unsigned char* address = reinterpret_cast<const unsigned char*>(object);
+                return static_cast<size_t>(address - reinterpret_cast<const unsigned char*>(m_slots.data())) / sizeof(slot_type);
+            }
+
+            std::array<slot_type, t_capacity> m_slots;
+            occupancy_bitmap<t_capacity> m_live;
+            counter_type m_size = 0;
+            counter_type m_free_head = none;
+            //slots from here on have never been used
+            counter_type m_unused = 0;
+    };
+}
@@ -0,0 +1,145 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    //std::pmr::memory_resource handing out memory from a buffer of t_bytes inside the object,
+    //so that std::pmr containers can be used without touching the heap. requests are rounded
+    //up to a power of two size class. freed blocks are kept on one free list per size class,
+    //linked through their first bytes, and reused by the next request of that class. otherwise
+    //blocks are cut from the unused end of the buffer. both ways are O(1). a request that does
+    //not fit throws std::bad_alloc, there is no fallback to the heap. freed memory is poisoned
+    //as described in common.hpp. like std::pmr::unsynchronized_pool_resource it is not thread
+    //safe
+    template <size_t t_bytes>
+    class static_pool_resource: public std::pmr::memory_resource
+    {
+        public:
+            static_assert(t_bytes > 0, "static_pool_resource needs a capacity");
+
+            //constructors
+            static_pool_resource()
+            {
+                mark_memory_unaddressable(m_buffer, t_bytes);
+            }
+            static_pool_resource(const static_pool_resource&) = delete;
+            //destructor
+            ~static_pool_resource() override
+            {
+                //the buffer may be stack memory that is used for other things next
+                mark_memory_addressable(m_buffer, t_bytes);
+            }
+            //assignment
+            static_pool_resource& operator=(const static_pool_resource&) = delete;
+            //capacity
+            constexpr static size_t capacity()
+            {
+                return t_bytes;
+            }
+            //bytes cut from the buffer so far, including blocks now on the free lists
+            size_t used() const
+            {
+                return m_used;
+            }
+            //modifiers. makes the whole buffer available again without deallocating anything
+            //first, so everything allocated from it has to be out of use
+            void release()
+            {
+                mark_memory_addressable(m_buffer, m_used);
+                fill_freed_memory(m_buffer, m_used);
+                mark_memory_unaddressable(m_buffer, m_used);
+                m_free.fill(nullptr);
+                m_used = 0;
+            }
+        protected:
+            void* do_allocate(size_t bytes, size_t alignment) override
+            {
+                size_t size_class = class_of(std::max(bytes, alignment));
+
+                if(size_class >= class_count)
+                    throw std::bad_alloc();
+
+                size_t block = size_t(1) << size_class;
+
+                if(m_free[size_class] != nullptr)
+                {
+                    std::byte* head = m_free[size_class];
+
+                    //blocks of a class are only aligned to alignof(std::max_align_t) or their
+                    //size, whichever is less, so a more aligned request might not fit the head
+                    if(reinterpret_cast<uintptr_t>(head) % alignment == 0)
+                    {
+                        mark_memory_addressable(head, block);
+                        std::memcpy(&m_free[size_class], head, sizeof(std::byte*));
+                        return head;
+                    }
+                }
+
+                size_t block_alignment = std::max(alignment, std::min(block, alignof(std::max_align_t)));
+                uintptr_t start = reinterpret_cast<uintptr_t>(m_buffer) + m_used;
+                size_t padding = (block_alignment - start % block_alignment) % block_alignment;
+
+                if(padding + block > t_bytes - m_used)
+                    throw std::bad_alloc();
+
+                std::byte* allocated = m_buffer + m_used + padding;
+                m_used += padding + block;
+                mark_memory_addressable(allocated, block);
+                return allocated;
+            }
+            void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+            {
+                size_t size_class = class_of(std::max(bytes, alignment));
+                size_t block = size_t(1) << size_class;
+                std::byte* freed = static_cast<std::byte*>(pointer);
+
+                fill_freed_memory(freed, block);
+                std::memcpy(freed, &m_free[size_class], sizeof(std::byte*));
+                m_free[size_class] = freed;
+                mark_memory_unaddressable(freed, block);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+        private:
+            //the smallest block holds the free list link
+            static constexpr size_t min_class = sizeof(std::byte*) == 8 ? 3 : 2;
+
+            static constexpr size_t log2_ceil(size_t value)
+            {
+                size_t result = 0;
+                while((size_t(1) << result) < value)
+                    ++result;
+                return result;
+            }
+
+            //one past the largest class that fits in the buffer
+            static constexpr size_t class_count = log2_ceil(t_bytes) + 1;
+
+            static size_t class_of(size_t bytes)
+            {
+                uint64_t rounded = std::max<uint64_t>(bytes, uint64_t(1) << min_class) - 1;
+                rounded |= rounded >> 1;
+                rounded |= rounded >> 2;
+                rounded |= rounded >> 4;
+                rounded |= rounded >> 8;
+                rounded |= rounded >> 16;
+                rounded |= rounded >> 32;
+
+                //a request above 2^63 bytes wraps to 0 and is refused as too large
+                return rounded + 1 == 0 ? 64 : count_trailing_zeros(rounded + 1);
+            }
+
+            alignas(std::max_align_t) std::byte m_buffer[t_bytes];
+            std::array<std::byte*, class_count> m_free = {};
+            size_t m_used = 0;
+    };
+}
@@ -0,0 +1,454 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    //overflow policies for static_ring
+
+    //pushing onto a full ring is not allowed, like pushing past the capacity of a static_vector
+    struct no_overwrite {};
+
+    //pushing onto a full ring first drops the element at the opposite end, so the ring always
+    //holds the latest capacity elements
+    struct overwrite_oldest {};
+
+    //double ended queue in a fixed circular array. pushing and popping at either end is O(1)
+    //and never moves other elements. the elements start at a head slot and wrap around past the
+    //last slot, which is a mask for power of two capacities and a conditional subtraction
+    //otherwise. iterators are random access and wrap with the elements
+    template <typename t_data, size_t t_capacity, typename t_overflow = no_overwrite>
+    class static_ring
+    {
+        public:
+            using value_type = t_data;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using size_type = size_t;
+            using difference_type = std::ptrdiff_t;
+            using overflow = t_overflow;
+
+            static_assert(t_capacity > 0, "static_ring needs a capacity");
+            static_assert(std::is_same_v<overflow, no_overwrite> || std::is_same_v<overflow, overwrite_oldest>, "unknown overflow policy");
+
+            template <typename iter_value_type>
+            struct iterator_t
+            {
+                using difference_type = std::ptrdiff_t;
+                using value_type = std::remove_const_t<iter_value_type>;
+                using pointer = iter_value_type*;
+                using reference = iter_value_type&;
+                using iterator_category = std::random_access_iterator_tag;
+                using ring_pointer = std::conditional_t<std::is_const_v<iter_value_type>, const static_ring*, static_ring*>;
+
+                iterator_t& operator++()
+                {
+                    ++index;
+                    return *this;
+                }
+
+                iterator_t operator++(int)
+                {
+                    iterator_t tmp = *this;
+                    operator++();
+                    return tmp;
+                }
+
+                iterator_t& operator--()
+                {
+                    --index;
+                    return *this;
+                }
+
+                iterator_t operator--(int)
+                {
+                    iterator_t tmp = *this;
+                    operator--();
+                    return tmp;
+                }
+
+                iterator_t& operator+=(difference_type diff)
+                {
+                    index += diff;
+                    return *this;
+                }
+
+                iterator_t operator+(difference_type diff) const
+                {
+                    iterator_t tmp = *this;
+                    tmp.index += diff;
+                    return tmp;
+                }
+
+                friend iterator_t operator+(difference_type diff, const iterator_t& iter)
+                {
+                    return iter + diff;
+                }
+
+                iterator_t& operator-=(difference_type diff)
+                {
+                    index -= diff;
+                    return *this;
+                }
+
+                difference_type operator-(iterator_t iter) const
+                {
+                    return static_cast<difference_type>(index) - static_cast<difference_type>(iter.index);
+                }
+
+                iterator_t operator-(difference_type diff) const
+                {
+                    iterator_t tmp = *this;
+                    tmp.index -= diff;
+                    return tmp;
+                }
+
+                reference operator*() const
+                {
+                    return (*ring)[index];
+                }
+
+                pointer operator->() const
+                {
+                    return &(*ring)[index];
+                }
+
+                reference operator[](difference_type offset) const
+                {
+                    return *(*this + offset);
+                }
+
+                bool operator==(const iterator_t& other) const
+                {
+                    return index == other.index;
+                }
+
+                bool operator!=(const iterator_t& other) const
+                {
+                    return !(*this == other);
+                }
+
+                bool operator<(const iterator_t& other) const
+                {
+                    return index < other.index;
+                }
+
+                bool operator>(const iterator_t& other) const
+                {
+                    return index > other.index;
+                }
+
+                bool operator<=(const iterator_t& other) const
+                {
+                    return index <= other.index;
+                }
+
+                bool operator>=(const iterator_t& other) const
+                {
+                    return index >= other.index;
+                }
+
+                template<typename U = iter_value_type, typename = typename std::enable_if_t<!std::is_const_v<U>>>
+                operator iterator_t<const U>() const
+                {
+                    return {ring, index};
+                }
+
+                ring_pointer ring = nullptr;
+                //position counted from the front, not the slot
+                size_type index = 0;
+            };
+
+            using iterator = iterator_t<value_type>;
+            using const_iterator = iterator_t<const value_type>;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            //constructors
+            static_ring() = default;
+            static_ring(std::initializer_list<value_type> data)
+            {
+                for(const value_type& item : data)
+                    push_back(item);
+            }
+            static_ring(const static_ring& other)
+            {
+                for(const_reference item : other)
+                    push_back(item);
+            }
+            static_ring(static_ring&& other)
+            {
+                for(reference item : other)
+                    push_back(std::move(item));
+
+                other.clear();
+            }
+            //destructor
+            ~static_ring()
+            {
+                clear();
+            }
+            //assignment
+            static_ring& operator=(const static_ring& other)
+            {
+                if(&other == this)
+                    return *this;
+
+                clear();
+
+                for(const_reference item : other)
+                    push_back(item);
+
+                return *this;
+            }
+            static_ring& operator=(static_ring&& other)
+            {
+                if(&other == this)
+                    return *this;
+
+                clear();
+
+                for(reference item : other)
+                    push_back(std::move(item));
+
+                other.clear();
+
+                return *this;
+            }
+            //element access
+            reference at(size_type index)
+            {
+                return const_cast<reference>(const_cast<const static_ring&>(*this).at(index));
+            }
+            const_reference at(size_type index) const
+            {
+                if(index >= m_size)
+                {
+                    throw std::out_of_range("accessing out of static_ring bounds");
+                }
+                return (*this)[index];
+            }
+            reference operator[](size_type index)
+            {
+                return m_storage[slot(index)].get();
+            }
+            const_reference operator[](size_type index) const
+            {
+                return m_storage[slot(index)].get();
+            }
+            reference front()
+            {
+                return m_storage[m_head].get();
+            }
+            const_reference front() const
+            {
+                return m_storage[m_head].get();
+            }
+            reference back()
+            {
+                return (*this)[m_size - 1];
+            }
+            const_reference back() const
+            {
+                return (*this)[m_size - 1];
+            }
+            //iterators
+            iterator begin()
+            {
+                return {this, 0};
+            }
+            const_iterator begin() const
+            {
+                return {this, 0};
+            }
+            const_iterator cbegin() const
+            {
+                return begin();
+            }
+            iterator end()
+            {
+                return {this, m_size};
+            }
+            const_iterator end() const
+            {
+                return {this, m_size};
+            }
+            const_iterator cend() const
+            {
+                return end();
+            }
+            reverse_iterator rbegin()
+            {
+                return reverse_iterator{end()};
+            }
+            const_reverse_iterator rbegin() const
+            {
+                return const_reverse_iterator{end()};
+            }
+            const_reverse_iterator crbegin() const
+            {
+                return rbegin();
+            }
+            reverse_iterator rend()
+            {
+                return reverse_iterator{begin()};
+            }
+            const_reverse_iterator rend() const
+            {
+                return const_reverse_iterator{begin()};
+            }
+            const_reverse_iterator crend() const
+            {
+                return rend();
+            }
+            //capacity
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+            size_type size() const
+            {
+                return m_size;
+            }
+            constexpr size_type max_size() const
+            {
+                return t_capacity;
+            }
+            constexpr static size_type capacity()
+            {
+                return t_capacity;
+            }
+            bool full() const
+            {
+                return m_size == t_capacity;
+            }
+            //modifiers
+            void clear()
+            {
+                if constexpr(!std::is_trivially_destructible_v<value_type>)
+                {
+                    for(size_type i = 0; i < m_size; ++i)
+                        m_storage[slot(i)].destroy();
+                }
+
+                m_head = 0;
+                m_size = 0;
+            }
+            reference push_back(const value_type& new_entry)
+            {
+                return emplace_back(new_entry);
+            }
+            reference push_back(value_type&& new_entry)
+            {
+                return emplace_back(std::move(new_entry));
+            }
+            //with overwrite_oldest a full ring builds the new element before dropping the oldest
+            //one, since args may refer to it, and moves it into place afterwards
+            template <typename ...Args>
+            reference emplace_back(Args&&... args)
+            {
+                if constexpr(std::is_same_v<overflow, overwrite_oldest>)
+                {
+                    if(full())
+                    {
+                        value_type new_entry(std::forward<Args>(args)...);
+                        pop_front();
+                        return emplace_back(std::move(new_entry));
+                    }
+                }
+                //ASSERT(!full(), "adding entry to full static ring of size " << t_capacity << "\n");
+
+                size_type index = slot(m_size);
+                m_storage[index].set(std::forward<Args>(args)...);
+                ++m_size;
+                return m_storage[index].get();
+            }
+            reference push_front(const value_type& new_entry)
+            {
+                return emplace_front(new_entry);
+            }
+            reference push_front(value_type&& new_entry)
+            {
+                return emplace_front(std::move(new_entry));
+            }
+            //with overwrite_oldest a full ring drops its back element, which is the oldest one
+            //as seen from the front, once the new element has been built
+            template <typename ...Args>
+            reference emplace_front(Args&&... args)
+            {
+                if constexpr(std::is_same_v<overflow, overwrite_oldest>)
+                {
+                    if(full())
+                    {
+                        value_type new_entry(std::forward<Args>(args)...);
+                        pop_back();
+                        return emplace_front(std::move(new_entry));
+                    }
+                }
+                //ASSERT(!full(), "adding entry to full static ring of size " << t_capacity << "\n");
+
+                size_type index = m_head == 0 ? t_capacity - 1 : m_head - 1;
+                m_storage[index].set(std::forward<Args>(args)...);
+                m_head = static_cast<counter_type>(index);
+                ++m_size;
+                return m_storage[index].get();
+            }
+            void pop_front()
+            {
+                //ASSERT(m_size > 0, "trying to pop_front an empty static ring");
+
+                m_storage[m_head].destroy();
+                m_head = static_cast<counter_type>(slot(1));
+                --m_size;
+            }
+            void pop_back()
+            {
+                //ASSERT(m_size > 0, "trying to pop_back an empty static ring");
+
+                m_storage[slot(m_size - 1)].destroy();
+                --m_size;
+            }
+        private:
+            using counter_type = smallest_unsigned_t<t_capacity>;
+
+            static constexpr bool power_of_two = (t_capacity & (t_capacity - 1)) == 0;
+
+            //slot of the element index positions after the front. index is at most the
+            //capacity, so at most one wrap is needed
+            size_type slot(size_type index) const
+            {
+                size_type position = m_head + index;
+
+                if constexpr(power_of_two)
+                    return position & (t_capacity - 1);
+                else
+                    return position >= t_capacity ? position - t_capacity : position;
+            }
+
+            std::array<container_storage<value_type>, t_capacity> m_storage;
+            counter_type m_head = 0;
+            counter_type m_size = 0;
+    };
+
+    template <typename t_data, size_t t_a_capacity, typename t_a_overflow, size_t t_b_capacity, typename t_b_overflow>
+    bool operator==(const static_ring<t_data, t_a_capacity, t_a_overflow>& a, const static_ring<t_data, t_b_capacity, t_b_overflow>& b)
+    {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+
+    template <typename t_data, size_t t_a_capacity, typename t_a_overflow, size_t t_b_capacity, typename t_b_overflow>
+    bool operator!=(const static_ring<t_data, t_a_capacity, t_a_overflow>& a, const static_ring<t_data, t_b_capacity, t_b_overflow>& b)
+    {
+        return !(a == b);
+    }
+}
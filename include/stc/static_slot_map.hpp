@@ -0,0 +1,316 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    //identifies an element of a static_slot_map for as long as it is in the map. the
+    //generation tells apart the elements that use the same slot one after another, so a
+    //handle to an erased element never reaches the element stored there later
+    struct slot_map_handle
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+        uint32_t generation = 0;
+
+        bool operator==(const slot_map_handle& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const slot_map_handle& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    //pool of elements addressed by handles that stay valid until their element is erased.
+    //the elements themselves are kept packed at the front of one array, so iterating over
+    //them is iterating over contiguous memory, and erasing moves the last element into the
+    //hole. a handle refers to a slot which knows where its element currently is. slots of
+    //erased elements are chained into a free list through that same field, and slots never
+    //used yet are taken in order, so no free list has to be built up front. a slot's
+    //generation is odd while it holds an element. insertion, erasure and lookup are O(1)
+    template <typename t_data, size_t t_capacity>
+    class static_slot_map
+    {
+        public:
+            using value_type = t_data;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using iterator = pointer;
+            using const_iterator = const_pointer;
+            using size_type = size_t;
+            using handle = slot_map_handle;
+
+            static_assert(t_capacity > 0, "static_slot_map needs a capacity");
+            static_assert(t_capacity < std::numeric_limits<uint32_t>::max(), "static_slot_map handles hold 32 bit indices");
+
+            //constructors
+            static_slot_map() = default;
+            static_slot_map(const static_slot_map& other)
+            {
+                copy_metadata(other);
+
+                for(size_type i = 0; i < m_size; ++i)
+                    m_values[i].set(other.m_values[i].get());
+            }
+            static_slot_map(static_slot_map&& other)
+            {
+                copy_metadata(other);
+
+                for(size_type i = 0; i < m_size; ++i)
+                    m_values[i].set(std::move(other.m_values[i].get()));
+
+                other.clear();
+            }
+            //destructor
+            ~static_slot_map()
+            {
+                destroy_values();
+            }
+            //assignment
+            static_slot_map& operator=(const static_slot_map& other)
+            {
+                if(&other == this)
+                    return *this;
+
+                destroy_values();
+                copy_metadata(other);
+
+                for(size_type i = 0; i < m_size; ++i)
+                    m_values[i].set(other.m_values[i].get());
+
+                return *this;
+            }
+            static_slot_map& operator=(static_slot_map&& other)
+            {
+                if(&other == this)
+                    return *this;
+
+                destroy_values();
+                copy_metadata(other);
+
+                for(size_type i = 0; i < m_size; ++i)
+                    m_values[i].set(std::move(other.m_values[i].get()));
+
+                other.clear();
+
+                return *this;
+            }
+            //element access
+            bool contains(handle h) const
+            {
+                return h.index < m_unused && m_slots[h.index].generation == h.generation && (h.generation & 1) != 0;
+            }
+            //nullptr when the element of h has been erased
+            pointer find(handle h)
+            {
+                return contains(h) ? &m_values[m_slots[h.index].position].get() : nullptr;
+            }
+            const_pointer find(handle h) const
+            {
+                return contains(h) ? &m_values[m_slots[h.index].position].get() : nullptr;
+            }
+            reference at(handle h)
+            {
+                return const_cast<reference>(const_cast<const static_slot_map&>(*this).at(h));
+            }
+            const_reference at(handle h) const
+            {
+                if(!contains(h))
+                {
+                    throw std::out_of_range("accessing static_slot_map with a stale handle");
+                }
+                return (*this)[h];
+            }
+            reference operator[](handle h)
+            {
+                return m_values[m_slots[h.index].position].get();
+            }
+            const_reference operator[](handle h) const
+            {
+                return m_values[m_slots[h.index].position].get();
+            }
+            //handle of the element at position index of the packed elements
+            handle handle_at(size_type index) const
+            {
+                counter_type slot = m_owners[index];
+                return {static_cast<uint32_t>(slot), m_slots[slot].generation};
+            }
+            pointer data()
+            {
+                return &m_values[0].get();
+            }
+            const_pointer data() const
+            {
+                return &m_values[0].get();
+            }
+            //iterators. erasing moves the last element, so it invalidates the end and the
+            //erased position
+            iterator begin()
+            {
+                return data();
+            }
+            const_iterator begin() const
+            {
+                return data();
+            }
+            const_iterator cbegin() const
+            {
+                return begin();
+            }
+            iterator end()
+            {
+                return data() + m_size;
+            }
+            const_iterator end() const
+            {
+                return data() + m_size;
+            }
+            const_iterator cend() const
+            {
+                return end();
+            }
+            //capacity
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+            size_type size() const
+            {
+                return m_size;
+            }
+            constexpr size_type max_size() const
+            {
+                return t_capacity;
+            }
+            constexpr static size_type capacity()
+            {
+                return t_capacity;
+            }
+            bool full() const
+            {
+                return m_size == t_capacity;
+            }
+            //modifiers
+            handle insert(const value_type& new_entry)
+            {
+                return emplace(new_entry);
+            }
+            handle insert(value_type&& new_entry)
+            {
+                return emplace(std::move(new_entry));
+            }
+            template <typename ...Args>
+            handle emplace(Args&&... args)
+            {
+                //ASSERT(!full(), "adding entry to full static slot map of size " << t_capacity << "\n");
+
+                counter_type slot;
+                if(m_free_head != none)
+                {
+                    slot = m_free_head;
+                    m_free_head = m_slots[slot].position;
+                }
+                else
+                {
+                    slot = m_unused++;
+                }
+
+                m_values[m_size].set(std::forward<Args>(args)...);
+                m_owners[m_size] = slot;
+                m_slots[slot].position = m_size;
+                ++m_slots[slot].generation;
+                ++m_size;
+
+                return {static_cast<uint32_t>(slot), m_slots[slot].generation};
+            }
+            //returns false when h has been erased already
+            bool erase(handle h)
+            {
+                if(!contains(h))
+                    return false;
+
+                counter_type position = m_slots[h.index].position;
+                counter_type last = static_cast<counter_type>(m_size - 1);
+
+                if(position != last)
+                {
+                    m_values[position].get() = std::move(m_values[last].get());
+                    m_owners[position] = m_owners[last];
+                    m_slots[m_owners[position]].position = position;
+                }
+
+                m_values[last].destroy();
+                --m_size;
+
+                ++m_slots[h.index].generation;
+                m_slots[h.index].position = m_free_head;
+                m_free_head = static_cast<counter_type>(h.index);
+
+                return true;
+            }
+            //also makes every handle stale
+            void clear()
+            {
+                destroy_values();
+
+                for(size_type i = 0; i < m_unused; ++i)
+                {
+                    if(m_slots[i].generation & 1)
+                        ++m_slots[i].generation;
+
+                    m_slots[i].position = i + 1 < m_unused ? static_cast<counter_type>(i + 1) : none;
+                }
+
+                m_free_head = m_unused > 0 ? 0 : none;
+                m_size = 0;
+            }
+        private:
+            //one more than the capacity needs, to have a value for the end of the free list
+            using counter_type = smallest_unsigned_t<t_capacity + 1>;
+
+            static constexpr counter_type none = static_cast<counter_type>(t_capacity);
+
+            struct slot_type
+            {
+                uint32_t generation = 0;
+                //where the element is while the slot is in use, otherwise the next free slot
+                counter_type position = none;
+            };
+
+            void destroy_values()
+            {
+                if constexpr(!std::is_trivially_destructible_v<value_type>)
+                {
+                    for(size_type i = 0; i < m_size; ++i)
+                        m_values[i].destroy();
+                }
+            }
+            void copy_metadata(const static_slot_map& other)
+            {
+                m_slots = other.m_slots;
+                m_owners = other.m_owners;
+                m_size = other.m_size;
+                m_free_head = other.m_free_head;
+                m_unused = other.m_unused;
+            }
+
+            std::array<container_storage<value_type>, t_capacity> m_values;
+            //slot of each element
+            std::array<counter_type, t_capacity> m_owners = {};
+            std::array<slot_type, t_capacity> m_slots;
+            counter_type m_size = 0;
+            counter_type m_free_head = none;
+            //slots from here on have never been used
+            counter_type m_unused = 0;
+    };
+}
@@ -0,0 +1,501 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    //contiguous run of one field of a static_soa_vector, for loops that only need that field
+    template <typename t_value>
+    class soa_column
+    {
+        public:
+            using value_type = std::remove_const_t<t_value>;
+            using size_type = size_t;
+            using iterator = t_value*;
+
+            soa_column(t_value* data, size_type size):
+                m_data(data),
+                m_size(size)
+            {
+            }
+
+            t_value& operator[](size_type index) const
+            {
+                return m_data[index];
+            }
+            t_value* data() const
+            {
+                return m_data;
+            }
+            iterator begin() const
+            {
+                return m_data;
+            }
+            iterator end() const
+            {
+                return m_data + m_size;
+            }
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+            size_type size() const
+            {
+                return m_size;
+            }
+        private:
+            t_value* m_data;
+            size_type m_size;
+    };
+
+    //vector of records whose fields are stored apart, each in an array of its own aligned to a
+    //cache line, so that a loop over one field reads nothing but that field and can be
+    //vectorized by the compiler. elements are handed out as tuples of references to their
+    //fields, and data<field>() and column<field>() give a whole field at once. the columns
+    //are always of the same length, every modifier touches all of them
+    template <size_t t_capacity, typename... t_fields>
+    class static_soa_vector
+    {
+        public:
+            using value_type = std::tuple<t_fields...>;
+            using reference = std::tuple<t_fields&...>;
+            using const_reference = std::tuple<const t_fields&...>;
+            using size_type = size_t;
+            using difference_type = std::ptrdiff_t;
+
+            template <size_t t_field>
+            using field_type = std::tuple_element_t<t_field, value_type>;
+
+            static_assert(sizeof...(t_fields) > 0, "static_soa_vector needs at least one field");
+            static_assert((std::is_same_v<t_fields, std::remove_cv_t<std::remove_reference_t<t_fields>>> && ...), "static_soa_vector fields have to be plain object types");
+
+            template <bool t_const>
+            struct iterator_t
+            {
+                using difference_type = std::ptrdiff_t;
+                using value_type = static_soa_vector::value_type;
+                using reference = std::conditional_t<t_const, const_reference, static_soa_vector::reference>;
+                using pointer = void;
+                using iterator_category = std::random_access_iterator_tag;
+                using vector_pointer = std::conditional_t<t_const, const static_soa_vector*, static_soa_vector*>;
+
+                iterator_t& operator++()
+                {
+                    ++index;
+                    return *this;
+                }
+
+                iterator_t operator++(int)
+                {
+                    iterator_t tmp = *this;
+                    ++index;
+                    return tmp;
+                }
+
+                iterator_t& operator--()
+                {
+                    --index;
+                    return *this;
+                }
+
+                iterator_t operator--(int)
+                {
+                    iterator_t tmp = *this;
+                    --index;
+                    return tmp;
+                }
+
+                iterator_t& operator+=(difference_type offset)
+                {
+                    index = static_cast<size_type>(static_cast<difference_type>(index) + offset);
+                    return *this;
+                }
+
+                iterator_t& operator-=(difference_type offset)
+                {
+                    return *this += -offset;
+                }
+
+                iterator_t operator+(difference_type offset) const
+                {
+                    iterator_t result = *this;
+                    return result += offset;
+                }
+
+                iterator_t operator-(difference_type offset) const
+                {
+                    iterator_t result = *this;
+                    return result -= offset;
+                }
+
+                difference_type operator-(const iterator_t& other) const
+                {
+                    return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+                }
+
+                reference operator*() const
+                {
+                    return (*vector)[index];
+                }
+
+                reference operator[](difference_type offset) const
+                {
+                    return *(*this + offset);
+                }
+
+                bool operator==(const iterator_t& other) const
+                {
+                    return index == other.index;
+                }
+
+                bool operator!=(const iterator_t& other) const
+                {
+                    return index != other.index;
+                }
+
+                bool operator<(const iterator_t& other) const
+                {
+                    return index < other.index;
+                }
+
+                bool operator>(const iterator_t& other) const
+                {
+                    return index > other.index;
+                }
+
+                bool operator<=(const iterator_t& other) const
+                {
+                    return index <= other.index;
+                }
+
+                bool operator>=(const iterator_t& other) const
+                {
+                    return index >= other.index;
+                }
+
+                template <bool t_other_const, typename = std::enable_if_t<t_other_const && !t_const>>
+                operator iterator_t<t_other_const>() const
+                {
+                    return {vector, index};
+                }
+
+                vector_pointer vector = nullptr;
+                size_type index = 0;
+            };
+
+            using iterator = iterator_t<false>;
+            using const_iterator = iterator_t<true>;
+
+            //constructors
+            static_soa_vector() = default;
+            static_soa_vector(const static_soa_vector& other)
+            {
+                copy_from(other);
+            }
+            static_soa_vector(static_soa_vector&& other)
+            {
+                move_from(other);
+            }
+            //destructor
+            ~static_soa_vector()
+            {
+                destroy(0);
+            }
+            //assignment
+            static_soa_vector& operator=(const static_soa_vector& other)
+            {
+                if(&other != this)
+                {
+                    clear();
+                    copy_from(other);
+                }
+
+                return *this;
+            }
+            static_soa_vector& operator=(static_soa_vector&& other)
+            {
+                if(&other != this)
+                {
+                    clear();
+                    move_from(other);
+                }
+
+                return *this;
+            }
+            //element access
+            reference at(size_type index)
+            {
+                if(index >= m_size)
+                    throw std::out_of_range("accessing out of static_soa_vector bounds");
+
+                return (*this)[index];
+            }
+            const_reference at(size_type index) const
+            {
+                if(index >= m_size)
+                    throw std::out_of_range("accessing out of static_soa_vector bounds");
+
+                return (*this)[index];
+            }
+            reference operator[](size_type index)
+            {
+                return element_at<reference>(*this, index, field_indices{});
+            }
+            const_reference operator[](size_type index) const
+            {
+                return element_at<const_reference>(*this, index, field_indices{});
+            }
+            reference front()
+            {
+                return (*this)[0];
+            }
+            const_reference front() const
+            {
+                return (*this)[0];
+            }
+            reference back()
+            {
+                return (*this)[m_size - 1];
+            }
+            const_reference back() const
+            {
+                return (*this)[m_size - 1];
+            }
+            //column access. the first field_type<t_field> of a column is aligned to a cache line
+            template <size_t t_field>
+            field_type<t_field>* data()
+            {
+                return &std::get<t_field>(m_columns).slots[0].get();
+            }
+            template <size_t t_field>
+            const field_type<t_field>* data() const
+            {
+                return &std::get<t_field>(m_columns).slots[0].get();
+            }
+            template <size_t t_field>
+            soa_column<field_type<t_field>> column()
+            {
+                return {data<t_field>(), m_size};
+            }
+            template <size_t t_field>
+            soa_column<const field_type<t_field>> column() const
+            {
+                return {data<t_field>(), m_size};
+            }
+            //iterators
+            iterator begin()
+            {
+                return {this, 0};
+            }
+            const_iterator begin() const
+            {
+                return {this, 0};
+            }
+            const_iterator cbegin() const
+            {
+                return begin();
+            }
+            iterator end()
+            {
+                return {this, m_size};
+            }
+            const_iterator end() const
+            {
+                return {this, m_size};
+            }
+            const_iterator cend() const
+            {
+                return end();
+            }
+            //capacity
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+            size_type size() const
+            {
+                return m_size;
+            }
+            constexpr static size_type capacity()
+            {
+                return t_capacity;
+            }
+            bool full() const
+            {
+                return m_size == t_capacity;
+            }
+            //modifiers
+            void clear()
+            {
+                destroy(0);
+                m_size = 0;
+            }
+            //takes one argument per field, each constructing that field
+            template <typename... Args>
+            reference emplace_back(Args&&... fields)
+            {
+                static_assert(sizeof...(Args) == sizeof...(t_fields), "emplace_back takes one argument per field");
+
+                size_type index = m_size++;
+                //ASSERT(m_size <= t_capacity, "adding entry to full static soa vector of size " << t_capacity << "\n");
+                construct(index, field_indices{}, std::forward<Args>(fields)...);
+                return (*this)[index];
+            }
+            reference push_back(const value_type& new_entry)
+            {
+                return std::apply([this](const t_fields&... fields) -> reference { return emplace_back(fields...); }, new_entry);
+            }
+            reference push_back(value_type&& new_entry)
+            {
+                return std::apply([this](t_fields&&... fields) -> reference { return emplace_back(std::move(fields)...); }, std::move(new_entry));
+            }
+            void pop_back()
+            {
+                //ASSERT(m_size > 0, "trying to pop_back an empty static soa vector");
+                destroy(m_size - 1);
+                --m_size;
+            }
+            //keeps the order of the elements, shifting each column down in turn
+            iterator erase(const_iterator position)
+            {
+                return erase(position, position + 1);
+            }
+            iterator erase(const_iterator erase_start, const_iterator erase_end)
+            {
+                size_type index = erase_start.index;
+                size_type erase_count = erase_end.index - erase_start.index;
+
+                if(erase_count != 0)
+                {
+                    for_each_column([&](auto& column)
+                    {
+                        for(size_type i = index + erase_count; i < m_size; ++i)
+                            column.slots[i - erase_count].get() = std::move(column.slots[i].get());
+                    });
+
+                    destroy(m_size - erase_count);
+                    m_size = static_cast<counter_type>(m_size - erase_count);
+                }
+
+                return {this, index};
+            }
+            //moves the last element into the erased one, which is O(1) but does not keep the
+            //order of the elements
+            iterator erase_unordered(const_iterator position)
+            {
+                size_type index = position.index;
+                size_type last = m_size - 1u;
+
+                if(index != last)
+                {
+                    for_each_column([&](auto& column)
+                    {
+                        column.slots[index].get() = std::move(column.slots[last].get());
+                    });
+                }
+
+                pop_back();
+                return {this, index};
+            }
+            //new elements have every field value initialized
+            void resize(size_type new_size)
+            {
+                if(new_size < m_size)
+                {
+                    destroy(new_size);
+                }
+                else
+                {
+                    for_each_column([&](auto& column)
+                    {
+                        for(size_type i = m_size; i < new_size; ++i)
+                            column.slots[i].set();
+                    });
+                }
+
+                m_size = static_cast<counter_type>(new_size);
+            }
+        private:
+            using counter_type = smallest_unsigned_t<t_capacity>;
+            using field_indices = std::index_sequence_for<t_fields...>;
+
+            template <typename t_field>
+            struct column_type
+            {
+                static_assert(sizeof(container_storage<t_field>) == sizeof(t_field), "fields must be contiguous to be handed out as arrays");
+
+                alignas(cache_line_size) alignas(t_field) std::array<container_storage<t_field>, t_capacity> slots;
+            };
+
+            template <typename function_type>
+            void for_each_column(function_type&& function)
+            {
+                std::apply([&](auto&... columns) { (function(columns), ...); }, m_columns);
+            }
+
+            template <typename result_type, typename vector_type, size_t... t_field>
+            static result_type element_at(vector_type& vector, size_type index, std::index_sequence<t_field...>)
+            {
+                return result_type(std::get<t_field>(vector.m_columns).slots[index].get()...);
+            }
+
+            template <size_t... t_field, typename... Args>
+            void construct(size_type index, std::index_sequence<t_field...>, Args&&... fields)
+            {
+                (std::get<t_field>(m_columns).slots[index].set(std::forward<Args>(fields)), ...);
+            }
+
+            //destroys the elements from first on without changing the size
+            void destroy(size_type first)
+            {
+                for_each_column([&](auto& column)
+                {
+                    using slot_value_type = typename std::remove_reference_t<decltype(column.slots[0])>::value_type;
+
+                    if constexpr(!std::is_trivially_destructible_v<slot_value_type>)
+                    {
+                        for(size_type i = first; i < m_size; ++i)
+                            column.slots[i].destroy();
+                    }
+                });
+            }
+
+            void copy_from(const static_soa_vector& other)
+            {
+                for(size_type i = 0; i < other.m_size; ++i)
+                    element_copy(other, i, field_indices{});
+
+                m_size = other.m_size;
+            }
+
+            void move_from(static_soa_vector& other)
+            {
+                for(size_type i = 0; i < other.m_size; ++i)
+                    element_move(other, i, field_indices{});
+
+                m_size = other.m_size;
+                other.clear();
+            }
+
+            template <size_t... t_field>
+            void element_copy(const static_soa_vector& other, size_type index, std::index_sequence<t_field...>)
+            {
+                (std::get<t_field>(m_columns).slots[index].set(std::get<t_field>(other.m_columns).slots[index].get()), ...);
+            }
+
+            template <size_t... t_field>
+            void element_move(static_soa_vector& other, size_type index, std::index_sequence<t_field...>)
+            {
+                (std::get<t_field>(m_columns).slots[index].set(std::move(std::get<t_field>(other.m_columns).slots[index].get())), ...);
+            }
+
+            std::tuple<column_type<t_fields>...> m_columns;
+            counter_type m_size = 0;
+    };
+}
@@ -0,0 +1,170 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    //lock free queue passing elements from exactly one producer thread to exactly one consumer
+    //thread. head and tail count every pop and push ever made and each is only written by one
+    //side, so the other side just needs to read it. each side also keeps its last reading of
+    //the other side's index and only reads the shared one again when the cached value says the
+    //queue is full or empty, which keeps the cache line of the other index from bouncing
+    //between cores on every call. the indices and the elements are on separate cache lines
+    template <typename t_data, size_t t_capacity>
+    class static_spsc_queue
+    {
+        public:
+            using value_type = t_data;
+            using size_type = size_t;
+
+            static_assert(t_capacity > 0, "static_spsc_queue needs a capacity");
+
+            //constructors
+            static_spsc_queue() = default;
+            static_spsc_queue(const static_spsc_queue&) = delete;
+            static_spsc_queue(static_spsc_queue&&) = delete;
+            //destructor
+            ~static_spsc_queue()
+            {
+                size_type tail = m_tail.load(std::memory_order_relaxed);
+                for(size_type i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+                    m_storage[slot(i)].destroy();
+            }
+            //assignment
+            static_spsc_queue& operator=(const static_spsc_queue&) = delete;
+            static_spsc_queue& operator=(static_spsc_queue&&) = delete;
+            //producer side
+            bool try_push(const value_type& value)
+            {
+                return try_emplace(value);
+            }
+            bool try_push(value_type&& value)
+            {
+                return try_emplace(std::move(value));
+            }
+            template <typename ...Args>
+            bool try_emplace(Args&&... args)
+            {
+                size_type tail = m_tail.load(std::memory_order_relaxed);
+
+                if(free_slots(tail, 1) == 0)
+                    return false;
+
+                m_storage[slot(tail)].set(std::forward<Args>(args)...);
+                m_tail.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+            //pushes copies of up to count elements starting at first and publishes them all at
+            //once. returns how many fit
+            template <typename input_iter>
+            size_type try_push_n(input_iter first, size_type count)
+            {
+                size_type tail = m_tail.load(std::memory_order_relaxed);
+                size_type pushed = std::min(count, free_slots(tail, count));
+
+                for(size_type i = 0; i < pushed; ++i, ++first)
+                    m_storage[slot(tail + i)].set(*first);
+
+                m_tail.store(tail + pushed, std::memory_order_release);
+                return pushed;
+            }
+            //consumer side
+            bool try_pop(value_type& value)
+            {
+                size_type head = m_head.load(std::memory_order_relaxed);
+
+                if(filled_slots(head, 1) == 0)
+                    return false;
+
+                value_type& stored = m_storage[slot(head)].get();
+                value = std::move(stored);
+                m_storage[slot(head)].destroy();
+                m_head.store(head + 1, std::memory_order_release);
+                return true;
+            }
+            //moves up to count elements to out and frees their slots at once. returns how many
+            //there were
+            template <typename output_iter>
+            size_type try_pop_n(output_iter out, size_type count)
+            {
+                size_type head = m_head.load(std::memory_order_relaxed);
+                size_type popped = std::min(count, filled_slots(head, count));
+
+                for(size_type i = 0; i < popped; ++i, ++out)
+                {
+                    auto& stored = m_storage[slot(head + i)];
+                    *out = std::move(stored.get());
+                    stored.destroy();
+                }
+
+                m_head.store(head + popped, std::memory_order_release);
+                return popped;
+            }
+            //capacity. exact only when neither side is running
+            bool empty() const
+            {
+                return size() == 0;
+            }
+            size_type size() const
+            {
+                size_type head = m_head.load(std::memory_order_acquire);
+                return m_tail.load(std::memory_order_acquire) - head;
+            }
+            constexpr static size_type capacity()
+            {
+                return t_capacity;
+            }
+        private:
+            static constexpr bool power_of_two = (t_capacity & (t_capacity - 1)) == 0;
+
+            static size_type slot(size_type index)
+            {
+                if constexpr(power_of_two)
+                    return index & (t_capacity - 1);
+                else
+                    return index % t_capacity;
+            }
+            //called by the producer. the shared head is only read when the cached one does not
+            //leave room for wanted elements
+            size_type free_slots(size_type tail, size_type wanted)
+            {
+                size_type free = t_capacity - (tail - m_cached_head);
+
+                if(free < wanted)
+                {
+                    m_cached_head = m_head.load(std::memory_order_acquire);
+                    free = t_capacity - (tail - m_cached_head);
+                }
+
+                return free;
+            }
+            //called by the consumer. the shared tail is only read when the cached one does not
+            //cover wanted elements
+            size_type filled_slots(size_type head, size_type wanted)
+            {
+                size_type filled = m_cached_tail - head;
+
+                if(filled < wanted)
+                {
+                    m_cached_tail = m_tail.load(std::memory_order_acquire);
+                    filled = m_cached_tail - head;
+                }
+
+                return filled;
+            }
+
+            //written by the producer
+            alignas(cache_line_size) std::atomic<size_type> m_tail = 0;
+            size_type m_cached_head = 0;
+            //written by the consumer
+            alignas(cache_line_size) std::atomic<size_type> m_head = 0;
+            size_type m_cached_tail = 0;
+
+            alignas(cache_line_size) std::array<container_storage<value_type>, t_capacity> m_storage;
+    };
+}
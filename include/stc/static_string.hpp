@@ -0,0 +1,504 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <stc/common.hpp>
+
+namespace stc
+{
+    template <typename t_char, size_t t_capacity, typename t_traits, bool compact>
+    struct basic_static_string_base;
+
+    //the last character of the buffer holds how many more characters fit. when the string is
+    //full that count is 0, which is also the terminating null, so t_capacity characters, the
+    //terminator and the length all fit in t_capacity + 1 characters
+    template <typename t_char, size_t t_capacity, typename t_traits>
+    struct basic_static_string_base<t_char, t_capacity, t_traits, true>
+    {
+        constexpr basic_static_string_base()
+        {
+            m_chars[t_capacity] = static_cast<t_char>(t_capacity);
+        }
+        constexpr size_t size() const
+        {
+            return t_capacity - static_cast<std::make_unsigned_t<t_char>>(m_chars[t_capacity]);
+        }
+        constexpr void set_size(size_t size)
+        {
+            m_chars[size] = t_char();
+            m_chars[t_capacity] = static_cast<t_char>(t_capacity - size);
+        }
+
+        t_char m_chars[t_capacity + 1] = {};
+    };
+
+    //capacities too large for the count to fit a character keep it next to the buffer
+    template <typename t_char, size_t t_capacity, typename t_traits>
+    struct basic_static_string_base<t_char, t_capacity, t_traits, false>
+    {
+        constexpr size_t size() const
+        {
+            return m_size;
+        }
+        constexpr void set_size(size_t size)
+        {
+            m_chars[size] = t_char();
+            m_size = static_cast<smallest_unsigned_t<t_capacity>>(size);
+        }
+
+        t_char m_chars[t_capacity + 1] = {};
+        smallest_unsigned_t<t_capacity> m_size = 0;
+    };
+
+    template <typename t_char, size_t t_capacity>
+    inline constexpr bool compact_static_string_v = t_capacity <= std::numeric_limits<std::make_unsigned_t<t_char>>::max();
+
+    //string of at most t_capacity characters stored inline. the characters are always
+    //followed by a null, so c_str() and data() need no copy, and the string converts to
+    //std::basic_string_view, through which the searches are done. up to 255 chars, or more for
+    //wider character types, the whole string takes exactly t_capacity + 1 characters, which
+    //makes it trivially copyable and dense as a map key or struct member. growing beyond the
+    //capacity throws std::length_error, except through append_truncated
+    template <typename t_char, size_t t_capacity, typename t_traits = std::char_traits<t_char>>
+    class basic_static_string: private basic_static_string_base<t_char, t_capacity, t_traits, compact_static_string_v<t_char, t_capacity>>
+    {
+            using base = basic_static_string_base<t_char, t_capacity, t_traits, compact_static_string_v<t_char, t_capacity>>;
+            using base::m_chars;
+        public:
+            using traits_type = t_traits;
+            using value_type = t_char;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using iterator = pointer;
+            using const_iterator = const_pointer;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+            using size_type = size_t;
+            using difference_type = std::ptrdiff_t;
+            using view_type = std::basic_string_view<value_type, traits_type>;
+
+            static constexpr size_type npos = view_type::npos;
+
+            static_assert(t_capacity > 0, "basic_static_string needs a capacity");
+
+            //constructors
+            constexpr basic_static_string() = default;
+            STC_CONSTEXPR20 basic_static_string(const value_type* text)
+            {
+                assign(view_type(text));
+            }
+            STC_CONSTEXPR20 explicit basic_static_string(view_type text)
+            {
+                assign(text);
+            }
+            STC_CONSTEXPR20 basic_static_string(size_type count, value_type character)
+            {
+                assign(count, character);
+            }
+            //assignment
+            STC_CONSTEXPR20 basic_static_string& operator=(view_type text)
+            {
+                return assign(text);
+            }
+            STC_CONSTEXPR20 basic_static_string& operator=(const value_type* text)
+            {
+                return assign(view_type(text));
+            }
+            STC_CONSTEXPR20 basic_static_string& assign(view_type text)
+            {
+                check_length(text.size());
+                traits_type::move(m_chars, text.data(), text.size());
+                this->set_size(text.size());
+                return *this;
+            }
+            STC_CONSTEXPR20 basic_static_string& assign(size_type count, value_type character)
+            {
+                check_length(count);
+                traits_type::assign(m_chars, count, character);
+                this->set_size(count);
+                return *this;
+            }
+            //element access
+            constexpr reference at(size_type index)
+            {
+                return const_cast<reference>(const_cast<const basic_static_string&>(*this).at(index));
+            }
+            constexpr const_reference at(size_type index) const
+            {
+                if(index >= size())
+                {
+                    throw std::out_of_range("accessing out of static_string bounds");
+                }
+                return m_chars[index];
+            }
+            constexpr reference operator[](size_type index)
+            {
+                return m_chars[index];
+            }
+            constexpr const_reference operator[](size_type index) const
+            {
+                return m_chars[index];
+            }
+            constexpr reference front()
+            {
+                return m_chars[0];
+            }
+            constexpr const_reference front() const
+            {
+                return m_chars[0];
+            }
+            constexpr reference back()
+            {
+                return m_chars[size() - 1];
+            }
+            constexpr const_reference back() const
+            {
+                return m_chars[size() - 1];
+            }
+            constexpr pointer data()
+            {
+                return m_chars;
+            }
+            constexpr const_pointer data() const
+            {
+                return m_chars;
+            }
+            constexpr const_pointer c_str() const
+            {
+                return m_chars;
+            }
+            constexpr operator view_type() const
+            {
+                return view_type(m_chars, size());
+            }
+            //iterators
+            constexpr iterator begin()
+            {
+                return m_chars;
+            }
+            constexpr const_iterator begin() const
+            {
+                return m_chars;
+            }
+            constexpr const_iterator cbegin() const
+            {
+                return begin();
+            }
+            constexpr iterator end()
+            {
+                return m_chars + size();
+            }
+            constexpr const_iterator end() const
+            {
+                return m_chars + size();
+            }
+            constexpr const_iterator cend() const
+            {
+                return end();
+            }
+            constexpr reverse_iterator rbegin()
+            {
+                return reverse_iterator{end()};
+            }
+            constexpr const_reverse_iterator rbegin() const
+            {
+                return const_reverse_iterator{end()};
+            }
+            constexpr const_reverse_iterator crbegin() const
+            {
+                return rbegin();
+            }
+            constexpr reverse_iterator rend()
+            {
+                return reverse_iterator{begin()};
+            }
+            constexpr const_reverse_iterator rend() const
+            {
+                return const_reverse_iterator{begin()};
+            }
+            constexpr const_reverse_iterator crend() const
+            {
+                return rend();
+            }
+            //capacity
+            constexpr bool empty() const
+            {
+                return size() == 0;
+            }
+            constexpr size_type size() const
+            {
+                return base::size();
+            }
+            constexpr size_type length() const
+            {
+                return size();
+            }
+            constexpr size_type max_size() const
+            {
+                return t_capacity;
+            }
+            constexpr static size_type capacity()
+            {
+                return t_capacity;
+            }
+            constexpr bool full() const
+            {
+                return size() == t_capacity;
+            }
+            //modifiers
+            constexpr void clear()
+            {
+                this->set_size(0);
+            }
+            constexpr void push_back(value_type character)
+            {
+                size_type old_size = size();
+                check_length(old_size + 1);
+                m_chars[old_size] = character;
+                this->set_size(old_size + 1);
+            }
+            constexpr void pop_back()
+            {
+                //ASSERT(size() > 0, "trying to pop_back an empty static string");
+                this->set_size(size() - 1);
+            }
+            STC_CONSTEXPR20 basic_static_string& append(view_type text)
+            {
+                size_type old_size = size();
+                check_length(old_size + text.size());
+                traits_type::move(m_chars + old_size, text.data(), text.size());
+                this->set_size(old_size + text.size());
+                return *this;
+            }
+            STC_CONSTEXPR20 basic_static_string& append(size_type count, value_type character)
+            {
+                size_type old_size = size();
+                check_length(old_size + count);
+                traits_type::assign(m_chars + old_size, count, character);
+                this->set_size(old_size + count);
+                return *this;
+            }
+            //appends as much of text as fits. returns false if some of it was cut off
+            STC_CONSTEXPR20 bool append_truncated(view_type text)
+            {
+                size_type old_size = size();
+                size_type count = std::min(text.size(), t_capacity - old_size);
+                traits_type::move(m_chars + old_size, text.data(), count);
+                this->set_size(old_size + count);
+                return count == text.size();
+            }
+            STC_CONSTEXPR20 basic_static_string& operator+=(view_type text)
+            {
+                return append(text);
+            }
+            STC_CONSTEXPR20 basic_static_string& operator+=(const value_type* text)
+            {
+                return append(view_type(text));
+            }
+            constexpr basic_static_string& operator+=(value_type character)
+            {
+                push_back(character);
+                return *this;
+            }
+            STC_CONSTEXPR20 void resize(size_type count, value_type character = value_type())
+            {
+                size_type old_size = size();
+                check_length(count);
+
+                if(count > old_size)
+                    traits_type::assign(m_chars + old_size, count - old_size, character);
+
+                this->set_size(count);
+            }
+            STC_CONSTEXPR20 basic_static_string& erase(size_type index = 0, size_type count = npos)
+            {
+                size_type old_size = size();
+                check_index(index);
+                count = std::min(count, old_size - index);
+                traits_type::move(m_chars + index, m_chars + index + count, old_size - index - count);
+                this->set_size(old_size - count);
+                return *this;
+            }
+            //operations
+            constexpr int compare(view_type other) const
+            {
+                return view_type(*this).compare(other);
+            }
+            constexpr bool starts_with(view_type prefix) const
+            {
+                return size() >= prefix.size() && traits_type::compare(m_chars, prefix.data(), prefix.size()) == 0;
+            }
+            constexpr bool starts_with(value_type character) const
+            {
+                return !empty() && traits_type::eq(front(), character);
+            }
+            constexpr bool ends_with(view_type suffix) const
+            {
+                return size() >= suffix.size() && traits_type::compare(m_chars + size() - suffix.size(), suffix.data(), suffix.size()) == 0;
+            }
+            constexpr bool ends_with(value_type character) const
+            {
+                return !empty() && traits_type::eq(back(), character);
+            }
+            constexpr size_type find(view_type text, size_type position = 0) const
+            {
+                return view_type(*this).find(text, position);
+            }
+            constexpr size_type find(value_type character, size_type position = 0) const
+            {
+                return view_type(*this).find(character, position);
+            }
+            constexpr size_type rfind(view_type text, size_type position = npos) const
+            {
+                return view_type(*this).rfind(text, position);
+            }
+            constexpr size_type rfind(value_type character, size_type position = npos) const
+            {
+                return view_type(*this).rfind(character, position);
+            }
+            constexpr bool contains(view_type text) const
+            {
+                return find(text) != npos;
+            }
+            constexpr bool contains(value_type character) const
+            {
+                return find(character) != npos;
+            }
+            STC_CONSTEXPR20 basic_static_string substr(size_type index = 0, size_type count = npos) const
+            {
+                check_index(index);
+                return basic_static_string(view_type(*this).substr(index, count));
+            }
+            //comparison with anything converting to view_type. two static strings are compared
+            //by the templates below
+            friend constexpr bool operator==(const basic_static_string& a, view_type b)
+            {
+                return view_type(a) == b;
+            }
+            friend constexpr bool operator==(view_type a, const basic_static_string& b)
+            {
+                return a == view_type(b);
+            }
+            friend constexpr bool operator!=(const basic_static_string& a, view_type b)
+            {
+                return !(a == b);
+            }
+            friend constexpr bool operator!=(view_type a, const basic_static_string& b)
+            {
+                return !(a == b);
+            }
+            friend constexpr bool operator<(const basic_static_string& a, view_type b)
+            {
+                return view_type(a) < b;
+            }
+            friend constexpr bool operator<(view_type a, const basic_static_string& b)
+            {
+                return a < view_type(b);
+            }
+            friend constexpr bool operator>(const basic_static_string& a, view_type b)
+            {
+                return b < a;
+            }
+            friend constexpr bool operator>(view_type a, const basic_static_string& b)
+            {
+                return b < a;
+            }
+            friend constexpr bool operator<=(const basic_static_string& a, view_type b)
+            {
+                return !(b < a);
+            }
+            friend constexpr bool operator<=(view_type a, const basic_static_string& b)
+            {
+                return !(b < a);
+            }
+            friend constexpr bool operator>=(const basic_static_string& a, view_type b)
+            {
+                return !(a < b);
+            }
+            friend constexpr bool operator>=(view_type a, const basic_static_string& b)
+            {
+                return !(a < b);
+            }
+        private:
+            constexpr static void check_length(size_type length)
+            {
+                if(length > t_capacity)
+                {
+                    throw std::length_error("exceeding static_string capacity");
+                }
+            }
+            constexpr void check_index(size_type index) const
+            {
+                if(index > size())
+                {
+                    throw std::out_of_range("accessing out of static_string bounds");
+                }
+            }
+    };
+
+    //static strings compare by their characters, whatever their capacities
+    template <typename t_char, size_t t_a_capacity, size_t t_b_capacity, typename t_traits>
+    constexpr bool operator==(const basic_static_string<t_char, t_a_capacity, t_traits>& a, const basic_static_string<t_char, t_b_capacity, t_traits>& b)
+    {
+        return std::basic_string_view<t_char, t_traits>(a) == std::basic_string_view<t_char, t_traits>(b);
+    }
+
+    template <typename t_char, size_t t_a_capacity, size_t t_b_capacity, typename t_traits>
+    constexpr bool operator!=(const basic_static_string<t_char, t_a_capacity, t_traits>& a, const basic_static_string<t_char, t_b_capacity, t_traits>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename t_char, size_t t_a_capacity, size_t t_b_capacity, typename t_traits>
+    constexpr bool operator<(const basic_static_string<t_char, t_a_capacity, t_traits>& a, const basic_static_string<t_char, t_b_capacity, t_traits>& b)
+    {
+        return std::basic_string_view<t_char, t_traits>(a) < std::basic_string_view<t_char, t_traits>(b);
+    }
+
+    template <typename t_char, size_t t_a_capacity, size_t t_b_capacity, typename t_traits>
+    constexpr bool operator>(const basic_static_string<t_char, t_a_capacity, t_traits>& a, const basic_static_string<t_char, t_b_capacity, t_traits>& b)
+    {
+        return b < a;
+    }
+
+    template <typename t_char, size_t t_a_capacity, size_t t_b_capacity, typename t_traits>
+    constexpr bool operator<=(const basic_static_string<t_char, t_a_capacity, t_traits>& a, const basic_static_string<t_char, t_b_capacity, t_traits>& b)
+    {
+        return !(b < a);
+    }
+
+    template <typename t_char, size_t t_a_capacity, size_t t_b_capacity, typename t_traits>
+    constexpr bool operator>=(const basic_static_string<t_char, t_a_capacity, t_traits>& a, const basic_static_string<t_char, t_b_capacity, t_traits>& b)
+    {
+        return !(a < b);
+    }
+
+    template <size_t t_capacity>
+    using static_string = basic_static_string<char, t_capacity>;
+
+    template <size_t t_capacity>
+    using static_wstring = basic_static_string<wchar_t, t_capacity>;
+}
+
+namespace std
+{
+    //transparent, so that static_map can look up static strings by their view
+    template <typename t_char, size_t t_capacity, typename t_traits>
+    struct hash<stc::basic_static_string<t_char, t_capacity, t_traits>>
+    {
+        using is_transparent = void;
+
+        size_t operator()(basic_string_view<t_char, t_traits> text) const
+        {
+            return hash<basic_string_view<t_char, t_traits>>{}(text);
+        }
+    };
+}
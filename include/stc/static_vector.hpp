@@ -3,6 +3,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <stdexcept>
@@ -12,8 +13,108 @@
 
 namespace stc
 {
+    template <typename t_data>
+    constexpr bool is_trivially_copyable_element_v = std::is_trivially_copy_constructible_v<t_data> && std::is_trivially_move_constructible_v<t_data> &&
+        std::is_trivially_copy_assignable_v<t_data> && std::is_trivially_move_assignable_v<t_data> && std::is_trivially_destructible_v<t_data>;
+
+    //owns the elements of a static_vector and their count. the count is kept in the smallest
+    //type able to hold the capacity and placed after the elements, so it mostly fits in what
+    //would otherwise be padding. when the elements are trivially copyable, copying, moving and
+    //destroying the whole container is left to the compiler, so that static_vector is
+    //trivially copyable as well and can be passed around with memcpy. a moved from
+    //static_vector then keeps its elements
+    template <typename t_data, size_t t_capacity, bool t_trivial = is_trivially_copyable_element_v<t_data>>
+    class static_vector_base
+    {
+        protected:
+            using counter_type = smallest_unsigned_t<t_capacity>;
+
+            STC_CONSTEXPR20 static_vector_base():
+                m_size(0)
+            {
+            }
+
+            std::array<container_storage<t_data>, t_capacity> m_storage;
+            counter_type m_size;
+    };
+
     template <typename t_data, size_t t_capacity>
-    class static_vector
+    class static_vector_base<t_data, t_capacity, false>
+    {
+        protected:
+            using counter_type = smallest_unsigned_t<t_capacity>;
+
+            STC_CONSTEXPR20 static_vector_base():
+                m_size(0)
+            {
+            }
+            STC_CONSTEXPR20 static_vector_base(const static_vector_base& other):
+                m_size(0)
+            {
+                copy_from(other);
+            }
+            STC_CONSTEXPR20 static_vector_base(static_vector_base&& other):
+                m_size(0)
+            {
+                move_from(other);
+            }
+            STC_CONSTEXPR20 ~static_vector_base()
+            {
+                destroy_elements();
+            }
+            STC_CONSTEXPR20 static_vector_base& operator=(const static_vector_base& other)
+            {
+                if(&other != this)
+                {
+                    destroy_elements();
+                    copy_from(other);
+                }
+
+                return *this;
+            }
+            STC_CONSTEXPR20 static_vector_base& operator=(static_vector_base&& other)
+            {
+                if(&other != this)
+                {
+                    destroy_elements();
+                    move_from(other);
+                }
+
+                return *this;
+            }
+
+            std::array<container_storage<t_data>, t_capacity> m_storage;
+            counter_type m_size;
+        private:
+            STC_CONSTEXPR20 void copy_from(const static_vector_base& other)
+            {
+                for(size_t i = 0; i < other.m_size; ++i)
+                    m_storage[i].set(other.m_storage[i].get());
+
+                m_size = other.m_size;
+            }
+            STC_CONSTEXPR20 void move_from(static_vector_base& other)
+            {
+                for(size_t i = 0; i < other.m_size; ++i)
+                    m_storage[i].set(std::move(other.m_storage[i].get()));
+
+                m_size = other.m_size;
+
+                other.destroy_elements();
+                other.m_size = 0;
+            }
+            STC_CONSTEXPR20 void destroy_elements()
+            {
+                if constexpr(!std::is_trivially_destructible_v<t_data>)
+                {
+                    for(size_t i = 0; i < m_size; ++i)
+                        m_storage[i].destroy();
+                }
+            }
+    };
+
+    template <typename t_data, size_t t_capacity>
+    class static_vector: private static_vector_base<t_data, t_capacity>
     {
         public:
             using value_type = t_data;
@@ -33,120 +134,120 @@ namespace stc
                 using reference = value_type&;
                 using iterator_category = std::random_access_iterator_tag;
 
-                iterator_t& operator++()
+                STC_CONSTEXPR20 iterator_t& operator++()
                 {
                     ++target;
                     return *this;
                 }
 
-                iterator_t operator++(int)
+                STC_CONSTEXPR20 iterator_t operator++(int)
                 {
                     iterator_t tmp = *this;
                     operator++();
                     return tmp;
                 }
 
-                iterator_t& operator--()
+                STC_CONSTEXPR20 iterator_t& operator--()
                 {
                     --target;
                     return *this;
                 }
 
-                iterator_t operator--(int)
+                STC_CONSTEXPR20 iterator_t operator--(int)
                 {
                     iterator_t tmp = *this;
                     operator--();
                     return tmp;
                 }
 
-                iterator_t& operator+=(difference_type diff)
+                STC_CONSTEXPR20 iterator_t& operator+=(difference_type diff)
                 {
                     target += diff;
                     return *this;
                 }
 
-                iterator_t operator+(difference_type diff) const
+                STC_CONSTEXPR20 iterator_t operator+(difference_type diff) const
                 {
                     iterator_t tmp = *this;
                     tmp.target += diff;
                     return tmp;
                 }
 
-                friend iterator_t operator+(difference_type diff, const iterator_t& iter)
+                STC_CONSTEXPR20 friend iterator_t operator+(difference_type diff, const iterator_t& iter)
                 {
                     return iter + diff;
                 }
 
-                iterator_t& operator-=(difference_type diff)
+                STC_CONSTEXPR20 iterator_t& operator-=(difference_type diff)
                 {
                     target -= diff;
                     return *this;
                 }
 
-                difference_type operator-(iterator_t  iter) const
+                STC_CONSTEXPR20 difference_type operator-(iterator_t  iter) const
                 {
                     return target - iter.target;
                 }
 
-                iterator_t operator-(difference_type diff) const
+                STC_CONSTEXPR20 iterator_t operator-(difference_type diff) const
                 {
                     iterator_t tmp = *this;
                     tmp.target -= diff;
                     return tmp;
                 }
 
-                friend iterator_t operator-(difference_type diff, const iterator_t& iter)
+                STC_CONSTEXPR20 friend iterator_t operator-(difference_type diff, const iterator_t& iter)
                 {
                     return iter - diff;
                 }
 
-                iter_value_type& operator*() const
+                STC_CONSTEXPR20 iter_value_type& operator*() const
                 {
                     return target->get();
                 }
 
-                iter_value_type* operator->() const
+                STC_CONSTEXPR20 iter_value_type* operator->() const
                 {
                     return &target->get();
                 }
 
-                iter_value_type& operator[](size_type index) const
+                STC_CONSTEXPR20 iter_value_type& operator[](size_type index) const
                 {
                     return (target + index)->get();
                 }
 
-                bool operator==(const iterator_t& other) const
+                STC_CONSTEXPR20 bool operator==(const iterator_t& other) const
                 {
                     return target == other.target;
                 }
 
-                bool operator!=(const iterator_t& other) const
+                STC_CONSTEXPR20 bool operator!=(const iterator_t& other) const
                 {
                     return !(*this == other);
                 }
 
-                bool operator<(const iterator_t& other) const
+                STC_CONSTEXPR20 bool operator<(const iterator_t& other) const
                 {
                     return target < other.target;
                 }
 
-                bool operator>(const iterator_t& other) const
+                STC_CONSTEXPR20 bool operator>(const iterator_t& other) const
                 {
                     return target > other.target;
                 }
 
-                bool operator<=(const iterator_t& other) const
+                STC_CONSTEXPR20 bool operator<=(const iterator_t& other) const
                 {
                     return target <= other.target;
                 }
 
-                bool operator>=(const iterator_t& other) const
+                STC_CONSTEXPR20 bool operator>=(const iterator_t& other) const
                 {
                     return target >= other.target;
                 }
 
                 template<typename U = iter_value_type, typename = typename std::enable_if_t<!std::is_const_v<U>>>
-                operator iterator_t<const U, const iter_storage_type>()
+                STC_CONSTEXPR20 operator iterator_t<const U, const iter_storage_type>()
                 {
                     return {target};
                 }
@@ -163,50 +264,35 @@ namespace stc
             using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
             //constructors
-            static_vector():
-                m_size(0)
-            {
-            }
-            explicit static_vector(size_type size, const value_type& data):
-                m_size(size)
+            static_vector() = default;
+            STC_CONSTEXPR20 explicit static_vector(size_type size, const value_type& data)
             {
-                for(size_type i = 0; i < m_size; ++i)
+                for(size_type i = 0; i < size; ++i)
                 {
                     m_storage[i].set(data);
                 }
+
+                m_size = static_cast<counter_type>(size);
             }
-            explicit static_vector(size_type size):
-                m_size(size)
+            STC_CONSTEXPR20 explicit static_vector(size_type size)
             {
-                for(size_type i = 0; i < m_size; ++i)
+                for(size_type i = 0; i < size; ++i)
                 {
                     m_storage[i].set();
                 }
+
+                m_size = static_cast<counter_type>(size);
             }
             template<typename input_iter, typename std::enable_if_t<is_input_iterator_v<input_iter>>* = nullptr>
-            static_vector(input_iter start, input_iter end):
-                m_size(0)
+            STC_CONSTEXPR20 static_vector(input_iter start, input_iter end)
             {
-                for(auto current = start; current != end; ++current)
-                    push_back(*current);
+                append(start, end);
             }
-            static_vector(const static_vector& other): m_size(0)
+            static_vector(const static_vector& other) = default;
+            static_vector(static_vector&& other) = default;
+            STC_CONSTEXPR20 static_vector(std::initializer_list<value_type> data)
             {
-                for(const_reference item : other)
-                    emplace_back(item);
-            }
-            static_vector(static_vector&& other): m_size(0)
-            {
-                for(reference item : other)
-                    emplace_back(std::move(item));
-
-                other.clear();
-            }
-            static_vector(std::initializer_list<value_type> data):
-                m_size(data.size())
-            {
-                for(size_type i = 0; i < m_size; ++i)
-                    m_storage[i].set(*(data.begin() + i));
+                append(data.begin(), data.end());
             }
             //TBI with a struct tag to disambiguate from std::initializer_list constructor maybe
             //template <size_type size>
@@ -217,77 +303,40 @@ namespace stc
             //        m_storage[i].set(std::forward<value_type>(arr[i]));
             //}
             //destructor
-            ~static_vector()
-            {
-                destroy();
-            }
+            ~static_vector() = default;
             //assignment
-            static_vector& operator=(const static_vector& other)
+            static_vector& operator=(const static_vector& other) = default;
+            static_vector& operator=(static_vector&& other) = default;
+            STC_CONSTEXPR20 static_vector& operator=(std::initializer_list<value_type> data)
             {
                 clear();
-
-                for(const_reference item : other)
-                    emplace_back(item);
-
-                return *this;
-            }
-            static_vector& operator=(static_vector&& other)
-            {
-                clear();
-
-                for(reference item : other)
-                    emplace_back(std::move(item));
-
-                other.clear();
-
-                return *this;
-            }
-            static_vector& operator=(std::initializer_list<value_type> data)
-            {
-                destroy();
-
-                m_size = data.size();
-
-                for(size_type i = 0; i < m_size; ++i)
-                    m_storage[i].set(*(data.begin() + i));
+                append(data.begin(), data.end());
 
                 return *this;
             }
             //assign
-            void assign(size_type count, const value_type& value)
+            STC_CONSTEXPR20 void assign(size_type count, const value_type& value)
             {
                 destroy();
 
-                m_size = count;
+                m_size = static_cast<counter_type>(count);
 
                 for(size_type i = 0; i < m_size; ++i)
                     m_storage[i].set(value);
             }
             template<typename input_iter, typename std::enable_if_t<is_input_iterator_v<input_iter>>* = nullptr>
-            void assign(input_iter start, input_iter end)
+            STC_CONSTEXPR20 void assign(input_iter start, input_iter end)
             {
-                destroy();
-
-                size_type i = 0;
-                for(auto current = start; current != end; ++current, ++i)
-                {
-                    m_storage[i].set(*current);
-                }
-
-                m_size = i;
+                clear();
+                append(start, end);
             }
-            void assign(std::initializer_list<value_type> data)
+            STC_CONSTEXPR20 void assign(std::initializer_list<value_type> data)
             {
-                destroy();
-
-                m_size = data.size();
-
-                auto current = data.begin();
-                for(size_type i = 0; i < m_size; ++i, ++current)
-                    m_storage[i].set(*current);
+                clear();
+                append(data.begin(), data.end());
             }
             //element access
-            reference at(size_type index)
+            STC_CONSTEXPR20 reference at(size_type index)
             {
                 if(index >= m_size)
                 {
@@ -295,7 +344,7 @@ namespace stc
                 }
                 return (*this)[index];
             }
-            const_reference at(size_type index) const
+            STC_CONSTEXPR20 const_reference at(size_type index) const
             {
                 if(index >= m_size)
                 {
@@ -303,93 +352,93 @@ namespace stc
                 }
                 return (*this)[index];
             }
-            reference operator[](size_type index)
+            STC_CONSTEXPR20 reference operator[](size_type index)
             {
                 return m_storage[index].get();
             }
-            const_reference operator[](size_type index) const
+            STC_CONSTEXPR20 const_reference operator[](size_type index) const
             {
                 return m_storage[index].get();
             }
-            reference front()
+            STC_CONSTEXPR20 reference front()
             {
                 return m_storage[0].get();
             }
-            const_reference front() const
+            STC_CONSTEXPR20 const_reference front() const
             {
                 return m_storage[0].get();
             }
-            reference back()
+            STC_CONSTEXPR20 reference back()
             {
                 return m_storage[m_size - 1].get();
             }
-            const_reference back() const
+            STC_CONSTEXPR20 const_reference back() const
             {
                 return m_storage[m_size - 1].get();
             }
-            value_type* data() noexcept
+            STC_CONSTEXPR20 value_type* data() noexcept
             {
                 return &(*this)[0];
             }
-            const value_type* data() const noexcept
+            STC_CONSTEXPR20 const value_type* data() const noexcept
             {
                 return &(*this)[0];
             }
             //iterators
-            iterator begin()
+            STC_CONSTEXPR20 iterator begin()
             {
                 return iterator{m_storage.data()};
             }
-            const_iterator begin() const
+            STC_CONSTEXPR20 const_iterator begin() const
             {
                 return const_iterator{m_storage.data()};
             }
-            const_iterator cbegin() const
+            STC_CONSTEXPR20 const_iterator cbegin() const
             {
                 return const_iterator{m_storage.data()};
             }
-            iterator end()
+            STC_CONSTEXPR20 iterator end()
             {
                 return begin() + m_size;
             }
-            const_iterator end() const
+            STC_CONSTEXPR20 const_iterator end() const
             {
                 return begin() + m_size;
             }
-            const_iterator cend() const
+            STC_CONSTEXPR20 const_iterator cend() const
             {
                 return begin() + m_size;
             }
-            reverse_iterator rbegin()
+            STC_CONSTEXPR20 reverse_iterator rbegin()
             {
                 return reverse_iterator{end()};
             }
-            const_reverse_iterator rbegin() const
+            STC_CONSTEXPR20 const_reverse_iterator rbegin() const
             {
                 return const_reverse_iterator{end()};
             }
-            const_reverse_iterator crbegin() const
+            STC_CONSTEXPR20 const_reverse_iterator crbegin() const
             {
                 return const_reverse_iterator{end()};
             }
-            reverse_iterator rend()
+            STC_CONSTEXPR20 reverse_iterator rend()
             {
                 return reverse_iterator{begin()};
             }
-            const_reverse_iterator rend() const
+            STC_CONSTEXPR20 const_reverse_iterator rend() const
             {
                 return const_reverse_iterator{begin()};
             }
-            const_reverse_iterator crend() const
+            STC_CONSTEXPR20 const_reverse_iterator crend() const
             {
                 return const_reverse_iterator{begin()};
             }
             //capacity
-            bool empty() const
+            STC_CONSTEXPR20 bool empty() const
             {
                 return m_size == 0;
             }
-            size_type size() const
+            STC_CONSTEXPR20 size_type size() const
             {
                 return m_size;
             }
@@ -401,126 +450,159 @@ namespace stc
             {
                 return t_capacity;
             }
-            bool full() const
+            STC_CONSTEXPR20 bool full() const
             {
                 return m_size == t_capacity;
             }
             //modifiers
-            void clear()
+            STC_CONSTEXPR20 void clear()
             {
                 destroy();
                 m_size = 0;
             }
-            iterator insert(const_iterator cposition, const value_type& value)
+            STC_CONSTEXPR20 iterator insert(const_iterator cposition, const value_type& value)
             {
                 //size_type target_index = index_of(cposition);
                 //ASSERT(target_index <= m_size, "trying to insert out of bounds or with bad iterator. iter: " << position << " index: " << target_index << "\n");
-                m_storage[m_size].set(value);
+                size_type index = index_of(cposition);
 
-                iterator position = non_const(cposition);
-                move_segment_down(end(), end() + 1, position);
+                if(index == m_size)
+                {
+                    push_back(value);
+                }
+                else
+                {
+                    //the value may be one of the elements about to be shifted
+                    value_type copy(value);
+                    open_gap(index, 1);
+                    m_storage[index].set(std::move(copy));
+                    ++m_size;
+                }
 
-                ++m_size;
-                return position;
+                return begin() + index;
             }
-            iterator insert(const_iterator cposition, value_type&& value)
+            STC_CONSTEXPR20 iterator insert(const_iterator cposition, value_type&& value)
             {
                 //size_type target_index = index_of(position);
                 //ASSERT(target_index <= m_size, "trying to insert out of bounds or with bad iterator. iter: " << position << " index: " << target_index << "\n");
-                m_storage[m_size].set(std::forward<value_type>(value));
-
-                iterator position = non_const(cposition);
-                move_segment_down(end(), end() + 1, position);
+                size_type index = index_of(cposition);
 
+                open_gap(index, 1);
+                m_storage[index].set(std::forward<value_type>(value));
                 ++m_size;
-                return position;
+
+                return begin() + index;
             }
-            iterator insert(const_iterator cposition, size_type count, const value_type& value)
+            STC_CONSTEXPR20 iterator insert(const_iterator cposition, size_type count, const value_type& value)
             {
-                size_t end_index = m_size + count;
+                size_type index = index_of(cposition);
+
+                if(count == 0)
+                    return begin() + index;
+
+                value_type copy(value);
+                open_gap(index, count);
 
-                for(size_type i = m_size; i < end_index; ++i)
+                for(size_type i = index; i < index + count; ++i)
                 {
-                    m_storage[i].set(value);
+                    m_storage[i].set(copy);
                 }
 
-                iterator position = non_const(cposition);
-                move_segment_down(end(), end() + count, position);
-
-                m_size += count;
-                return position;
+                m_size = static_cast<counter_type>(m_size + count);
+                return begin() + index;
             }
             template <typename input_iter, typename std::enable_if_t<is_input_iterator_v<input_iter>>* = nullptr>
-            iterator insert(const_iterator cposition, input_iter first, input_iter last)
+            STC_CONSTEXPR20 iterator insert(const_iterator cposition, input_iter first, input_iter last)
             {
-                auto current = first;
-                size_type i = m_size;
-                for(; current != last; ++i, ++current)
+                size_type index = index_of(cposition);
+
+                if constexpr(is_forward_iterator_v<input_iter>)
                 {
-                    m_storage[i].set(*current);
+                    size_type count = static_cast<size_type>(std::distance(first, last));
+                    open_gap(index, count);
+
+                    size_type i = index;
+                    for(auto current = first; current != last; ++i, ++current)
+                    {
+                        m_storage[i].set(*current);
+                    }
+
+                    m_size = static_cast<counter_type>(m_size + count);
                 }
-                size_type count = i - m_size;
+                else
+                {
+                    //the length is only known once the range is consumed, so it is appended
+                    //and rotated into place
+                    auto current = first;
+                    size_type i = m_size;
+                    for(; current != last; ++i, ++current)
+                    {
+                        m_storage[i].set(*current);
+                    }
+                    size_type count = i - m_size;
 
-                iterator position = non_const(cposition);
-                move_segment_down(end(), end() + count, position);
+                    move_segment_down(end(), end() + count, begin() + index);
 
-                m_size += count;
-                return position;
+                    m_size = static_cast<counter_type>(m_size + count);
+                }
+
+                return begin() + index;
             }
-            iterator insert(const_iterator cposition, std::initializer_list<value_type> ilist)
+            STC_CONSTEXPR20 iterator insert(const_iterator cposition, std::initializer_list<value_type> ilist)
             {
                 return insert(cposition, ilist.begin(), ilist.end());
             }
             template <typename... Args>
-            iterator emplace(const_iterator cposition, Args&&... args)
+            STC_CONSTEXPR20 iterator emplace(const_iterator cposition, Args&&... args)
             {
-                m_storage[m_size].set(std::forward<Args...>(args)...);
+                size_type index = index_of(cposition);
 
-                iterator position = non_const(cposition);
-                move_segment_down(end(), end() + 1, position);
+                if(index == m_size)
+                {
+                    emplace_back(std::forward<Args>(args)...);
+                }
+                else
+                {
+                    //the arguments may refer to elements about to be shifted
+                    value_type value(std::forward<Args>(args)...);
+                    open_gap(index, 1);
+                    m_storage[index].set(std::move(value));
+                    ++m_size;
+                }
 
-                ++m_size;
-                return position;
+                return begin() + index;
             }
-            iterator erase(const_iterator cposition)
+            STC_CONSTEXPR20 iterator erase(const_iterator cposition)
             {
                 //size_type index = index_of(cposition);
                 //ASSERT(index < m_size, "trying to erase out of bounds or with bad iterator. iter: " << position << " index: " << index << "\n");
 
                 return erase(cposition, cposition + 1);
             }
-            iterator erase(const_iterator cerase_start, const_iterator cerase_end)
+            STC_CONSTEXPR20 iterator erase(const_iterator cerase_start, const_iterator cerase_end)
             {
                 //size_type index = index_of(cposition);
                 //ASSERT(index < m_size, "trying to erase out of bounds or with bad iterator. iter: " << position << " index: " << index << "\n");
 
-                if(cerase_start == cerase_end)
-                    return non_const(cerase_start);
-
-                iterator erase_start = non_const(cerase_start);
-                iterator erase_end = non_const(cerase_end);
-                size_type erase_count = erase_end - erase_start;
-
-                std::rotate(erase_start, erase_start + erase_count, end());
+                size_type index = index_of(cerase_start);
+                size_type erase_count = static_cast<size_type>(cerase_end - cerase_start);
 
-                m_size -= erase_count;
-
-                size_type end_index = m_size + erase_count;
-                for(size_type i = m_size; i < end_index; ++i)
+                if(erase_count != 0)
                 {
-                    m_storage[i].destroy();
+                    close_gap(index, erase_count);
+                    m_size = static_cast<counter_type>(m_size - erase_count);
                 }
 
-                return erase_start;
+                return begin() + index;
             }
-            reference push_back(const value_type& new_entry)
+            STC_CONSTEXPR20 reference push_back(const value_type& new_entry)
             {
                 size_t index = m_size++;
                 m_storage[index].set(new_entry);
                 //ASSERT(m_size <= t_capacity, "adding entry to full static vector of size " << t_capacity << "\n");
                 return m_storage[index].get();
             }
-            reference push_back(value_type&& new_entry)
+            STC_CONSTEXPR20 reference push_back(value_type&& new_entry)
             {
                 size_t index = m_size++;
                 m_storage[index].set(std::forward<value_type>(new_entry));
@@ -528,21 +610,21 @@ namespace stc
                 return m_storage[index].get();
             }
             template <typename ...Args>
-            reference emplace_back(Args&&... args)
+            STC_CONSTEXPR20 reference emplace_back(Args&&... args)
             {
                 size_t index = m_size++;
                 m_storage[index].set(std::forward<Args>(args)...);
                 //ASSERT(m_size <= t_capacity, "adding entry to full static vector of size " << t_capacity << "\n");
                 return m_storage[index].get();
             }
-            void pop_back()
+            STC_CONSTEXPR20 void pop_back()
             {
                 //ASSERT(m_size > 0, "trying to pop_back an empty static vector");
 
                 m_storage[m_size - 1].destroy();
                 --m_size;
             }
-            void resize(size_type new_size)
+            STC_CONSTEXPR20 void resize(size_type new_size)
             {
                 if(new_size < m_size)
                 {
@@ -557,9 +639,9 @@ namespace stc
                         m_storage[i].set();
                 }
 
-                m_size = new_size;
+                m_size = static_cast<counter_type>(new_size);
             }
-            void resize(size_type new_size, const value_type& value)
+            STC_CONSTEXPR20 void resize(size_type new_size, const value_type& value)
             {
                 if(new_size < m_size)
                 {
@@ -574,34 +656,120 @@ namespace stc
                         m_storage[i].set(value);
                 }
 
-                m_size = new_size;
+                m_size = static_cast<counter_type>(new_size);
             }
         private:
-            void destroy()
+            using base = static_vector_base<t_data, t_capacity>;
+            using counter_type = typename base::counter_type;
+            using base::m_storage;
+            using base::m_size;
+
+            STC_CONSTEXPR20 void destroy()
             {
-                size_type s = size();
-                for(size_type i = 0; i < s; ++i)
-                    m_storage[i].destroy();
+                if constexpr(!std::is_trivially_destructible_v<value_type>)
+                {
+                    size_type s = size();
+                    for(size_type i = 0; i < s; ++i)
+                        m_storage[i].destroy();
+                }
+            }
+            //constructs copies of the range after the last element. trivially copyable
+            //elements from contiguous memory are copied with a single memcpy
+            template<typename input_iter>
+            STC_CONSTEXPR20 void append(input_iter start, input_iter end)
+            {
+                using source_type = std::remove_cv_t<std::remove_pointer_t<input_iter>>;
+
+                if constexpr(std::is_pointer_v<input_iter> && std::is_same_v<source_type, value_type> && std::is_trivially_copyable_v<value_type>)
+                {
+                    static_assert(sizeof(storage_type) == sizeof(value_type), "elements must be contiguous to be copied at once");
+
+                    if(!in_constant_evaluation())
+                    {
+                        size_type count = static_cast<size_type>(end - start);
+
+                        if(count != 0)
+                            std::memcpy(static_cast<void*>(m_storage.data() + m_size), start, count * sizeof(value_type));
+
+                        m_size = static_cast<counter_type>(m_size + count);
+                        return;
+                    }
+                }
+
+                for(auto current = start; current != end; ++current)
+                    emplace_back(*current);
             }
-            size_type index_of(const_iterator iter) const
+            STC_CONSTEXPR20 size_type index_of(const_iterator iter) const
             {
                 return iter - begin();
             }
-            iterator non_const(const_iterator iter)
+            STC_CONSTEXPR20 iterator non_const(const_iterator iter)
             {
                 return begin() + index_of(iter);
             }
-            void move_segment_down(iterator start, iterator end, iterator destination)
+            STC_CONSTEXPR20 void move_segment_down(iterator start, iterator end, iterator destination)
             {
                 std::rotate(destination, start, end);
             }
+            //shifts the elements from index on up by count, leaving the slots in between
+            //unconstructed. relocatable elements are moved with a single memmove, others are
+            //move constructed past the end or move assigned within it, once each
+            STC_CONSTEXPR20 void open_gap(size_type index, size_type count)
+            {
+                if constexpr(is_trivially_relocatable_v<value_type>)
+                {
+                    if(!in_constant_evaluation())
+                    {
+                        std::memmove(static_cast<void*>(m_storage.data() + index + count), static_cast<const void*>(m_storage.data() + index), (m_size - index) * sizeof(storage_type));
+                        return;
+                    }
+                }
+
+                size_type old_end = m_size;
+
+                for(size_type i = old_end; i-- > index;)
+                {
+                    size_type target = i + count;
+
+                    if(target >= old_end)
+                        m_storage[target].set(std::move(m_storage[i].get()));
+                    else
+                        m_storage[target].get() = std::move(m_storage[i].get());
+                }
+
+                size_type moved_from_end = std::min(index + count, old_end);
+                for(size_type i = index; i < moved_from_end; ++i)
+                    m_storage[i].destroy();
+            }
+            //destroys count elements from index on and shifts the ones after them down
+            STC_CONSTEXPR20 void close_gap(size_type index, size_type count)
+            {
+                if constexpr(is_trivially_relocatable_v<value_type>)
+                {
+                    if(!in_constant_evaluation())
+                    {
+                        if constexpr(!std::is_trivially_destructible_v<value_type>)
+                        {
+                            for(size_type i = index; i < index + count; ++i)
+                                m_storage[i].destroy();
+                        }
+
+                        std::memmove(static_cast<void*>(m_storage.data() + index), static_cast<const void*>(m_storage.data() + index + count), (m_size - index - count) * sizeof(storage_type));
+                        return;
+                    }
+                }
+
+                for(size_type i = index + count; i < m_size; ++i)
+                    m_storage[i - count].get() = std::move(m_storage[i].get());
+
+                for(size_type i = m_size - count; i < m_size; ++i)
+                    m_storage[i].destroy();
+            }
 
-            std::array<storage_type, t_capacity> m_storage;
-            size_type m_size;
     };
 
     template <typename t_data, size_t t_a_capacity, size_t t_b_capacity>
-    bool operator==(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
+    STC_CONSTEXPR20 bool operator==(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
     {
         size_t a_size = a.size();
         size_t b_size = b.size();
@@ -619,13 +787,13 @@ namespace stc
     }
 
     template <typename t_data, size_t t_a_capacity, size_t t_b_capacity>
-    bool operator!=(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
+    STC_CONSTEXPR20 bool operator!=(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
     {
         return !(a == b);
     }
 
     template <typename t_data, size_t t_a_capacity, size_t t_b_capacity>
-    bool operator<(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
+    STC_CONSTEXPR20 bool operator<(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
     {
         size_t a_size = a.size();
         size_t b_size = b.size();
@@ -643,19 +811,19 @@ namespace stc
     }
 
     template <typename t_data, size_t t_a_capacity, size_t t_b_capacity>
-    bool operator>(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
+    STC_CONSTEXPR20 bool operator>(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
     {
         return !(a == b || a < b);
     }
 
     template <typename t_data, size_t t_a_capacity, size_t t_b_capacity>
-    bool operator>=(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
+    STC_CONSTEXPR20 bool operator>=(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
     {
         return (a == b || a > b);
     }
 
     template <typename t_data, size_t t_a_capacity, size_t t_b_capacity>
-    bool operator<=(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
+    STC_CONSTEXPR20 bool operator<=(const static_vector<t_data, t_a_capacity>& a, const static_vector<t_data, t_b_capacity>& b)
     {
         return (a == b || a < b);
     }
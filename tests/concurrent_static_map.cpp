@@ -0,0 +1,108 @@
+#include "common.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stc/concurrent_static_map.hpp>
+
+TEST_CASE("concurrent_static_map reads what was written", "[concurrent_static_map]")
+{
+    stc::concurrent_static_map<int, std::string, 8> names;
+
+    REQUIRE(names.empty());
+    REQUIRE(names.insert({1, "one"}));
+    REQUIRE_FALSE(names.insert({1, "uno"}));
+    names.insert_or_assign(2, "two");
+    names.insert_or_assign(2, "dos");
+
+    REQUIRE(names.size() == 2);
+    REQUIRE(names.contains(1));
+    REQUIRE(names.get(1) == "one");
+    REQUIRE(names.get(2) == "dos");
+    REQUIRE_FALSE(names.get(3).has_value());
+
+    REQUIRE(names.erase(1));
+    REQUIRE_FALSE(names.erase(1));
+    REQUIRE_FALSE(names.contains(1));
+
+    size_t length = names.read([](const auto& map) { return map.at(2).size(); });
+    REQUIRE(length == 3);
+
+    //both copies get every change
+    for(int i = 0; i < 4; ++i)
+    {
+        names.modify([i](auto& map) { map[i + 10] = std::to_string(i); });
+        REQUIRE(names.size() == static_cast<size_t>(i + 2));
+    }
+
+    stc::static_map<int, std::string, 8> replacement({{7, "seven"}});
+    names.replace(replacement);
+    REQUIRE(names.size() == 1);
+    REQUIRE(names.get(7) == "seven");
+
+    names.clear();
+    REQUIRE(names.empty());
+
+    stc::concurrent_static_map<int, std::string, 8> initialized(replacement);
+    REQUIRE(initialized.get(7) == "seven");
+}
+
+TEST_CASE("concurrent_static_map readers only see whole versions", "[concurrent_static_map]")
+{
+    constexpr int key_count = 16;
+    constexpr int version_count = 2000;
+    stc::concurrent_static_map<int, int, 32> versions;
+
+    versions.modify([](auto& map)
+    {
+        for(int key = 0; key < key_count; ++key)
+            map[key] = 0;
+    });
+
+    std::atomic<bool> done = false;
+    std::atomic<bool> consistent = true;
+    std::vector<std::thread> readers;
+
+    for(int i = 0; i < 3; ++i)
+    {
+        readers.emplace_back([&]()
+        {
+            int last = 0;
+
+            while(!done.load())
+            {
+                int seen = versions.read([](const auto& map)
+                {
+                    int first = map.at(0);
+                    for(int key = 1; key < key_count; ++key)
+                    {
+                        if(map.at(key) != first)
+                            return -1;
+                    }
+                    return first;
+                });
+
+                if(seen < last)
+                    consistent = false;
+
+                last = seen;
+            }
+        });
+    }
+
+    for(int version = 1; version <= version_count; ++version)
+    {
+        versions.modify([version](auto& map)
+        {
+            for(int key = 0; key < key_count; ++key)
+                map[key] = version;
+        });
+    }
+
+    done = true;
+    for(std::thread& reader : readers)
+        reader.join();
+
+    REQUIRE(consistent);
+    REQUIRE(versions.get(key_count - 1) == version_count);
+}
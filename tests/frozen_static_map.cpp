@@ -0,0 +1,72 @@
+#include <catch/catch.hpp>
+#include <string>
+#include <stc/frozen_static_map.hpp>
+
+TEST_CASE("frozen_static_map built from static_flat_map", "[frozen_static_map]")
+{
+    stc::static_flat_map<int, int, 10> sorted = {{{5, 50}, {1, 10}, {9, 90}, {3, 30}}};
+    stc::frozen_static_map<int, int, 10> frozen(sorted);
+
+    REQUIRE(frozen.size() == 4);
+    REQUIRE(!frozen.empty());
+    REQUIRE(frozen.capacity == 10);
+
+    REQUIRE(frozen.at(1) == 10);
+    REQUIRE(frozen.at(3) == 30);
+    REQUIRE(frozen.at(5) == 50);
+    REQUIRE(frozen.at(9) == 90);
+    REQUIRE_THROWS(frozen.at(4));
+
+    REQUIRE(frozen.find(5)->second == 50);
+    REQUIRE(frozen.find(0) == frozen.end());
+    REQUIRE(frozen.find(10) == frozen.end());
+    REQUIRE(frozen.contains(9));
+    REQUIRE(frozen.count(2) == 0);
+
+    int visited = 0;
+    for(auto entry : frozen)
+    {
+        REQUIRE(entry.second == entry.first * 10);
+        ++visited;
+    }
+    REQUIRE(visited == 4);
+}
+
+TEST_CASE("frozen_static_map finds every key for all tree shapes", "[frozen_static_map]")
+{
+    for(int size = 0; size <= 70; ++size)
+    {
+        stc::static_flat_map<int, int, 70> sorted;
+
+        for(int i = 0; i < size; ++i)
+            sorted[i * 2] = i;
+
+        stc::frozen_static_map<int, int, 70> frozen(sorted);
+
+        REQUIRE(frozen.size() == static_cast<size_t>(size));
+
+        for(int key = -1; key <= size * 2; ++key)
+        {
+            bool present = key >= 0 && key % 2 == 0 && key < size * 2;
+            REQUIRE(frozen.contains(key) == present);
+
+            if(present)
+                REQUIRE(frozen.at(key) == key / 2);
+        }
+    }
+}
+
+TEST_CASE("make_frozen_static_map", "[frozen_static_map]")
+{
+    auto names = stc::make_frozen_static_map<std::string, int>({{"one", 1}, {"two", 2}, {"three", 3}});
+
+    REQUIRE(names.size() == 3);
+    REQUIRE(names.at("one") == 1);
+    REQUIRE(names.at("two") == 2);
+    REQUIRE(names.at("three") == 3);
+    REQUIRE(!names.contains("four"));
+
+    auto copied = names;
+
+    REQUIRE(copied.at("three") == 3);
+}
@@ -58,7 +58,7 @@ inline std::string to_string(const probe_counts& c)
     return res;
 }
 
-void update_count_min_max(probe_counts& c, int64_t existing, int64_t active)
+inline void update_count_min_max(probe_counts& c, int64_t existing, int64_t active)
 {
     c.min_existing = std::min(c.min_existing, existing);
     c.max_existing = std::max(c.max_existing, existing);
@@ -0,0 +1,85 @@
+#include <catch/catch.hpp>
+#include <string_view>
+#include <stc/perfect_static_map.hpp>
+
+namespace
+{
+    enum class tag { red, green, blue };
+
+    constexpr auto tags = stc::make_perfect_static_map<std::string_view, tag>({
+        {"red", tag::red},
+        {"green", tag::green},
+        {"blue", tag::blue},
+    });
+
+    static_assert(tags.size() == 3);
+    static_assert(tags.at("red") == tag::red);
+    static_assert(tags.at("green") == tag::green);
+    static_assert(tags.at("blue") == tag::blue);
+    static_assert(!tags.contains("yellow"));
+    static_assert(tags.find("") == tags.end());
+
+    int add(int a, int b) { return a + b; }
+    int sub(int a, int b) { return a - b; }
+    int mul(int a, int b) { return a * b; }
+
+    using handler = int(*)(int, int);
+
+    constexpr auto handlers = stc::make_perfect_static_map<uint8_t, handler>({
+        {0x01, &add},
+        {0x02, &sub},
+        {0x10, &mul},
+    });
+
+    static_assert(handlers.contains(0x10));
+    static_assert(!handlers.contains(0x03));
+}
+
+TEST_CASE("perfect_static_map lookups", "[perfect_static_map]")
+{
+    REQUIRE(tags.at("blue") == tag::blue);
+    REQUIRE(tags.count("green") == 1);
+    REQUIRE(tags.count("Green") == 0);
+    REQUIRE_THROWS(tags.at("purple"));
+
+    REQUIRE(handlers.at(0x01)(3, 4) == 7);
+    REQUIRE(handlers.at(0x02)(3, 4) == -1);
+    REQUIRE(handlers.at(0x10)(3, 4) == 12);
+    REQUIRE(handlers.find(0x11) == handlers.end());
+
+    int visited = 0;
+    for(const auto& entry : tags)
+    {
+        REQUIRE(tags.at(entry.first) == entry.second);
+        ++visited;
+    }
+    REQUIRE(visited == 3);
+}
+
+TEST_CASE("perfect_static_map places every key in its own slot", "[perfect_static_map]")
+{
+    constexpr size_t size = 200;
+
+    using map_type = stc::perfect_static_map<int, int, size>;
+
+    map_type::value_type entries[size] = {};
+    for(int i = 0; i < static_cast<int>(size); ++i)
+        entries[i] = {i * 7919, i};
+
+    map_type numbers(entries);
+
+    for(int i = 0; i < static_cast<int>(size); ++i)
+        REQUIRE(numbers.at(i * 7919) == i);
+
+    for(int i = 0; i < 1000; ++i)
+        REQUIRE(numbers.contains(i) == (i % 7919 == 0 && i / 7919 < static_cast<int>(size)));
+}
+
+TEST_CASE("perfect_static_map rejects duplicate keys", "[perfect_static_map]")
+{
+    using map_type = stc::perfect_static_map<int, int, 3>;
+
+    map_type::value_type entries[3] = {{1, 1}, {2, 2}, {1, 3}};
+
+    REQUIRE_THROWS(map_type(entries));
+}
@@ -0,0 +1,133 @@
+#include <catch/catch.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+#include <stc/static_flat_map.hpp>
+
+TEST_CASE("static_flat_map initial state", "[static_flat_map]")
+{
+    stc::static_flat_map<int, int, 50> numbers;
+
+    REQUIRE(numbers.empty());
+    REQUIRE(!numbers.full());
+    REQUIRE(numbers.size() == 0);
+    REQUIRE(numbers.capacity == 50);
+    REQUIRE(numbers.begin() == numbers.end());
+    REQUIRE(numbers.find(3) == numbers.end());
+    REQUIRE(numbers.lower_bound(3) == numbers.end());
+}
+
+TEST_CASE("static_flat_map storage and retrieval", "[static_flat_map]")
+{
+    stc::static_flat_map<int, int, 50> numbers;
+
+    numbers[5] = 2;
+
+    auto first_insert = numbers.insert({4, 7});
+
+    REQUIRE(numbers.size() == 2);
+    REQUIRE(first_insert.second);
+    REQUIRE(first_insert.first->first == 4);
+    REQUIRE(first_insert.first->second == 7);
+
+    REQUIRE(numbers.at(5) == 2);
+    REQUIRE(numbers.at(4) == 7);
+    REQUIRE(numbers[5] == 2);
+    REQUIRE_THROWS(numbers.at(6));
+
+    auto fail_insert = numbers.insert({4, 4});
+
+    REQUIRE(numbers.size() == 2);
+    REQUIRE(!fail_insert.second);
+    REQUIRE(fail_insert.first->second == 7);
+
+    REQUIRE(numbers.contains(4));
+    REQUIRE(numbers.count(5) == 1);
+    REQUIRE(!numbers.contains(6));
+}
+
+TEST_CASE("static_flat_map iterates in key order", "[static_flat_map]")
+{
+    stc::static_flat_map<int, int, 10> numbers = {{{5, 50}, {1, 10}, {9, 90}, {3, 30}}};
+
+    std::vector<int> keys;
+    for(auto entry : numbers)
+    {
+        REQUIRE(entry.second == entry.first * 10);
+        keys.push_back(entry.first);
+    }
+
+    REQUIRE(keys == std::vector<int>{1, 3, 5, 9});
+    REQUIRE(std::vector<int>(numbers.keys().begin(), numbers.keys().end()) == keys);
+    REQUIRE(numbers.rbegin()->first == 9);
+
+    stc::static_flat_map<int, int, 10, std::greater<int>> descending = {{{5, 50}, {1, 10}, {9, 90}}};
+
+    REQUIRE(descending.begin()->first == 9);
+    REQUIRE(descending.at(1) == 10);
+}
+
+TEST_CASE("static_flat_map bounds", "[static_flat_map]")
+{
+    stc::static_flat_map<int, int, 10> numbers = {{{10, 1}, {20, 2}, {30, 3}, {40, 4}, {50, 5}}};
+
+    REQUIRE(numbers.lower_bound(5)->first == 10);
+    REQUIRE(numbers.lower_bound(20)->first == 20);
+    REQUIRE(numbers.lower_bound(21)->first == 30);
+    REQUIRE(numbers.lower_bound(51) == numbers.end());
+    REQUIRE(numbers.upper_bound(20)->first == 30);
+    REQUIRE(numbers.upper_bound(50) == numbers.end());
+
+    auto range = numbers.equal_range(30);
+    REQUIRE(range.second - range.first == 1);
+    REQUIRE(range.first->first == 30);
+
+    auto empty_range = numbers.equal_range(35);
+    REQUIRE(empty_range.first == empty_range.second);
+
+    for(int key = 0; key < 60; ++key)
+    {
+        auto lower = numbers.lower_bound(key);
+        REQUIRE((lower == numbers.end() || lower->first >= key));
+        REQUIRE((lower == numbers.begin() || (lower - 1)->first < key));
+    }
+}
+
+TEST_CASE("static_flat_map erase", "[static_flat_map]")
+{
+    stc::static_flat_map<int, std::string, 10> numbers = {{{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}, {5, "e"}}};
+
+    REQUIRE(numbers.erase(3) == 1);
+    REQUIRE(numbers.erase(3) == 0);
+    REQUIRE(!numbers.contains(3));
+
+    auto next = numbers.erase(numbers.find(1));
+    REQUIRE(next->first == 2);
+
+    auto after_range = numbers.erase(numbers.lower_bound(2), numbers.upper_bound(4));
+    REQUIRE(after_range->first == 5);
+    REQUIRE(numbers.size() == 1);
+    REQUIRE(numbers.at(5) == "e");
+}
+
+TEST_CASE("static_flat_map full", "[static_flat_map]")
+{
+    stc::static_flat_map<int, int, 3> numbers;
+
+    numbers[3] = 1;
+    numbers[1] = 2;
+    numbers[2] = 3;
+
+    REQUIRE(numbers.full());
+
+    auto fail_insert = numbers.emplace(4, 4);
+    REQUIRE(!fail_insert.second);
+    REQUIRE(fail_insert.first == numbers.end());
+
+    REQUIRE_THROWS_AS(numbers[4], std::length_error);
+    REQUIRE(numbers.size() == 3);
+    REQUIRE(numbers[2] == 3);
+
+    numbers.clear();
+    REQUIRE(numbers.empty());
+}
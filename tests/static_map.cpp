@@ -1,112 +1,766 @@
 #include <catch/catch.hpp>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
 #include <stc/static_map.hpp>
 
-//TEST_CASE("static_map initial state", "[containers]")
-//{
-//    stc::static_map<int, int, 50> numbers;
-//
-//    REQUIRE(numbers.empty());
-//    REQUIRE(!numbers.full());
-//    REQUIRE(numbers.size() == 0);
-//    REQUIRE(numbers.capacity == 50);
-//}
-//
-//TEST_CASE("static_map basic storage and retrieval", "[containers]")
-//{
-//    stc::static_map<int, int, 50> numbers;
-//
-//    numbers[0] = 2;
-//
-//    REQUIRE(numbers.size() == 1);
-//
-//    auto first_insert = numbers.insert({4, 7});
-//
-//    REQUIRE(numbers.size() == 2);
-//    REQUIRE(first_insert.second);
-//    REQUIRE(first_insert.first->first == 4);
-//    REQUIRE(first_insert.first->second == 7);
-//
-//    REQUIRE(numbers.at(0) == 2);
-//    REQUIRE(numbers.at(4) == 7);
-//    REQUIRE(numbers[0] == 2);
-//    REQUIRE(numbers[4] == 7);
-//
-//    numbers[0] = 45;
-//
-//    REQUIRE(numbers.size() == 2);
-//    REQUIRE(numbers.at(0) == 45);
-//
-//    auto fail_insert = numbers.insert({4, 4});
-//
-//    REQUIRE(numbers.size() == 2);
-//    REQUIRE(!fail_insert.second);
-//}
-//
-//TEST_CASE("static_map count and contains", "[containers]")
-//{
-//    stc::static_map<int, int, 50> numbers;
-//
-//    numbers[7] = 23;
-//
-//    REQUIRE(numbers.count(0) == 0);
-//    REQUIRE(numbers.count(7) == 1);
-//    REQUIRE(!numbers.contains(10));
-//    REQUIRE(numbers.contains(7));
-//}
-//
-//TEST_CASE("static_map find, begin and end", "[containers]")
-//{
-//    stc::static_map<int, int, 50> numbers;
-//
-//    REQUIRE(numbers.begin() == numbers.end());
-//
-//    numbers = {{{1, 2}, {2, 3}}};
-//
-//    REQUIRE(numbers.begin() != numbers.end());
-//    
-//    auto iter = numbers.begin();
-//    REQUIRE(iter != numbers.end());
-//    REQUIRE(iter->first == 1);
-//    REQUIRE(iter->second == 2);
-//    ++iter;
-//    REQUIRE(iter != numbers.end());
-//    REQUIRE(iter->first == 2);
-//    REQUIRE(iter->second == 3);
-//    ++iter;
-//    REQUIRE(iter == numbers.end());
-//
-//    auto found = numbers.find(2);
-//
-//    REQUIRE(found != numbers.end());
-//    REQUIRE(found->first == 2);
-//    REQUIRE(found->second == 3);
-//
-//    auto not_found = numbers.find(23);
-//    REQUIRE(not_found == numbers.end());
-//}
-//
-//TEST_CASE("static_map clear", "[containers]")
-//{
-//    stc::static_map<int, int, 50> numbers = {{{2, 3}, {5, 8}}};
-//
-//    REQUIRE(numbers.size() == 2);
-//    REQUIRE(!numbers.empty());
-//
-//    numbers.clear();
-//
-//    REQUIRE(numbers.size() == 0);
-//    REQUIRE(numbers.empty());
-//}
-//
-//TEST_CASE("static_map full", "[containers]")
-//{
-//    stc::static_map<int, int, 3> numbers;
-//
-//    REQUIRE(!numbers.full());
-//    numbers[1] = 23;
-//    REQUIRE(!numbers.full());
-//    numbers[5] = 231;
-//    REQUIRE(!numbers.full());
-//    numbers[111] = 234;
-//    REQUIRE(numbers.full());
-//}
+TEST_CASE("static_map initial state", "[static_map]")
+{
+    stc::static_map<int, int, 50> numbers;
+
+    REQUIRE(numbers.empty());
+    REQUIRE(!numbers.full());
+    REQUIRE(numbers.size() == 0);
+    REQUIRE(numbers.capacity == 50);
+}
+
+TEST_CASE("static_map basic storage and retrieval", "[static_map]")
+{
+    stc::static_map<int, int, 50> numbers;
+
+    numbers[0] = 2;
+
+    REQUIRE(numbers.size() == 1);
+
+    auto first_insert = numbers.insert({4, 7});
+
+    REQUIRE(numbers.size() == 2);
+    REQUIRE(first_insert.second);
+    REQUIRE(first_insert.first->first == 4);
+    REQUIRE(first_insert.first->second == 7);
+
+    REQUIRE(numbers.at(0) == 2);
+    REQUIRE(numbers.at(4) == 7);
+    REQUIRE(numbers[0] == 2);
+    REQUIRE(numbers[4] == 7);
+
+    numbers[0] = 45;
+
+    REQUIRE(numbers.size() == 2);
+    REQUIRE(numbers.at(0) == 45);
+
+    auto fail_insert = numbers.insert({4, 4});
+
+    REQUIRE(numbers.size() == 2);
+    REQUIRE(!fail_insert.second);
+}
+
+TEST_CASE("static_map count and contains", "[static_map]")
+{
+    stc::static_map<int, int, 50> numbers;
+
+    numbers[7] = 23;
+
+    REQUIRE(numbers.count(0) == 0);
+    REQUIRE(numbers.count(7) == 1);
+    REQUIRE(!numbers.contains(10));
+    REQUIRE(numbers.contains(7));
+}
+
+TEST_CASE("static_map find, begin and end", "[static_map]")
+{
+    stc::static_map<int, int, 50> numbers;
+
+    REQUIRE(numbers.begin() == numbers.end());
+
+    numbers = {{{1, 2}, {2, 3}}};
+
+    REQUIRE(numbers.begin() != numbers.end());
+    
+    auto iter = numbers.begin();
+    REQUIRE(iter != numbers.end());
+    REQUIRE(iter->first == 1);
+    REQUIRE(iter->second == 2);
+    ++iter;
+    REQUIRE(iter != numbers.end());
+    REQUIRE(iter->first == 2);
+    REQUIRE(iter->second == 3);
+    ++iter;
+    REQUIRE(iter == numbers.end());
+
+    auto found = numbers.find(2);
+
+    REQUIRE(found != numbers.end());
+    REQUIRE(found->first == 2);
+    REQUIRE(found->second == 3);
+
+    auto not_found = numbers.find(23);
+    REQUIRE(not_found == numbers.end());
+}
+
+TEST_CASE("static_map clear", "[static_map]")
+{
+    stc::static_map<int, int, 50> numbers = {{{2, 3}, {5, 8}}};
+
+    REQUIRE(numbers.size() == 2);
+    REQUIRE(!numbers.empty());
+
+    numbers.clear();
+
+    REQUIRE(numbers.size() == 0);
+    REQUIRE(numbers.empty());
+}
+
+TEST_CASE("static_map full", "[static_map]")
+{
+    stc::static_map<int, int, 3> numbers;
+
+    REQUIRE(!numbers.full());
+    numbers[1] = 23;
+    REQUIRE(!numbers.full());
+    numbers[5] = 231;
+    REQUIRE(!numbers.full());
+    numbers[111] = 234;
+    REQUIRE(numbers.full());
+}
+
+struct colliding_hash
+{
+    size_t operator()(int key) const
+    {
+        return static_cast<size_t>(key / 10);
+    }
+};
+
+TEST_CASE("static_map colliding keys", "[static_map]")
+{
+    stc::static_map<int, int, 8, colliding_hash> numbers;
+
+    numbers[1] = 1;
+    numbers[2] = 2;
+    numbers[3] = 3;
+    numbers[11] = 11;
+
+    REQUIRE(numbers.size() == 4);
+    REQUIRE(numbers.at(1) == 1);
+    REQUIRE(numbers.at(2) == 2);
+    REQUIRE(numbers.at(3) == 3);
+    REQUIRE(numbers.at(11) == 11);
+    REQUIRE(!numbers.contains(4));
+    REQUIRE(!numbers.contains(12));
+}
+
+TEST_CASE("static_map erase keeps probe chains intact", "[static_map]")
+{
+    stc::static_map<int, int, 8, colliding_hash> numbers;
+
+    numbers[1] = 1;
+    numbers[2] = 2;
+    numbers[11] = 11;
+    numbers[3] = 3;
+
+    numbers.erase(1);
+
+    REQUIRE(numbers.size() == 3);
+    REQUIRE(!numbers.contains(1));
+    REQUIRE(numbers.at(2) == 2);
+    REQUIRE(numbers.at(11) == 11);
+    REQUIRE(numbers.at(3) == 3);
+
+    numbers.erase(2);
+    numbers.erase(3);
+
+    REQUIRE(numbers.size() == 1);
+    REQUIRE(numbers.at(11) == 11);
+
+    numbers[1] = 5;
+
+    REQUIRE(numbers.size() == 2);
+    REQUIRE(numbers.at(1) == 5);
+}
+
+TEST_CASE("static_map probe chains wrap around", "[static_map]")
+{
+    stc::static_map<int, int, 4, colliding_hash> numbers;
+
+    numbers[30] = 1;
+    numbers[31] = 2;
+    numbers[32] = 3;
+
+    REQUIRE(numbers.at(30) == 1);
+    REQUIRE(numbers.at(31) == 2);
+    REQUIRE(numbers.at(32) == 3);
+
+    numbers.erase(30);
+
+    REQUIRE(numbers.at(31) == 2);
+    REQUIRE(numbers.at(32) == 3);
+    REQUIRE(numbers.find(30) == numbers.end());
+}
+
+TEST_CASE("static_map insert and find when full", "[static_map]")
+{
+    stc::static_map<int, int, 3, colliding_hash> numbers = {{{1, 1}, {2, 2}, {3, 3}}};
+
+    REQUIRE(numbers.full());
+    REQUIRE(numbers.find(4) == numbers.end());
+
+    auto failed_insert = numbers.insert({4, 4});
+
+    REQUIRE(!failed_insert.second);
+    REQUIRE(failed_insert.first == numbers.end());
+    REQUIRE(numbers.size() == 3);
+
+    auto existing_insert = numbers.insert({2, 8});
+
+    REQUIRE(!existing_insert.second);
+    REQUIRE(existing_insert.first->second == 2);
+}
+
+TEST_CASE("static_map erase returns following element", "[static_map]")
+{
+    stc::static_map<int, int, 8, colliding_hash> numbers;
+
+    numbers[1] = 1;
+    numbers[2] = 2;
+    numbers[11] = 11;
+
+    auto next = numbers.erase(2);
+
+    REQUIRE(next != numbers.end());
+    REQUIRE(next->first == 11);
+
+    size_t visited = 0;
+    for(auto iter = numbers.begin(); iter != numbers.end(); ++iter)
+        ++visited;
+
+    REQUIRE(visited == 2);
+}
+
+template <typename probing, typename layout = stc::interleaved_layout, typename stats = stc::no_stats>
+void verify_erase_while_iterating()
+{
+    stc::static_map<int, int, 8, colliding_hash, std::equal_to<int>, probing, stats, layout> numbers;
+
+    //the chain of home slot 7 wraps around into the first slots, where the chains of home
+    //slots 0 to 2 continue it
+    for(int key : {70, 71, 72, 73, 1, 2, 11, 20})
+        numbers[key] = key;
+
+    REQUIRE(numbers.full());
+
+    std::vector<int> visited;
+    for(auto iter = numbers.begin(); iter != numbers.end();)
+    {
+        int key = iter->first;
+        visited.push_back(key);
+
+        if(key % 2 == 0)
+            iter = numbers.erase(key);
+        else
+            ++iter;
+    }
+
+    std::sort(visited.begin(), visited.end());
+    CHECK(visited == std::vector<int>{1, 2, 11, 20, 70, 71, 72, 73});
+    CHECK(numbers.size() == 4);
+
+    for(int key : {1, 11, 71, 73})
+        CHECK(numbers.at(key) == key);
+
+    visited.clear();
+    for(auto iter = numbers.begin(); iter != numbers.end();)
+    {
+        visited.push_back(iter->first);
+        iter = numbers.erase(iter->first);
+    }
+
+    std::sort(visited.begin(), visited.end());
+    CHECK(visited == std::vector<int>{1, 11, 71, 73});
+    CHECK(numbers.empty());
+}
+
+TEST_CASE("static_map erase while iterating visits every entry once", "[static_map]")
+{
+    verify_erase_while_iterating<stc::linear_probing>();
+    verify_erase_while_iterating<stc::linear_probing, stc::split_layout>();
+    verify_erase_while_iterating<stc::robin_hood_probing>();
+    verify_erase_while_iterating<stc::robin_hood_probing, stc::split_layout, stc::collect_stats>();
+}
+
+template <typename key_type, typename mapped_type, size_t capacity, typename hash = std::hash<key_type>>
+using robin_hood_map = stc::static_map<key_type, mapped_type, capacity, hash, std::equal_to<key_type>, stc::robin_hood_probing>;
+
+TEST_CASE("robin hood static_map colliding keys", "[static_map]")
+{
+    robin_hood_map<int, int, 8, colliding_hash> numbers;
+
+    numbers[1] = 1;
+    numbers[2] = 2;
+    numbers[11] = 11;
+    numbers[12] = 12;
+    numbers[3] = 3;
+
+    REQUIRE(numbers.size() == 5);
+    REQUIRE(numbers.at(1) == 1);
+    REQUIRE(numbers.at(2) == 2);
+    REQUIRE(numbers.at(3) == 3);
+    REQUIRE(numbers.at(11) == 11);
+    REQUIRE(numbers.at(12) == 12);
+    REQUIRE(!numbers.contains(4));
+    REQUIRE(!numbers.contains(13));
+}
+
+TEST_CASE("robin hood static_map erase shifts entries back", "[static_map]")
+{
+    robin_hood_map<int, int, 8, colliding_hash> numbers;
+
+    numbers[1] = 1;
+    numbers[2] = 2;
+    numbers[11] = 11;
+    numbers[3] = 3;
+
+    REQUIRE(numbers.probe_length(11) == 3);
+
+    numbers.erase(1);
+
+    REQUIRE(numbers.probe_length(11) == 2);
+    REQUIRE(numbers.at(2) == 2);
+    REQUIRE(numbers.at(11) == 11);
+    REQUIRE(numbers.at(3) == 3);
+
+    numbers.erase(2);
+    numbers.erase(3);
+
+    REQUIRE(numbers.size() == 1);
+    REQUIRE(numbers.probe_length(11) == 1);
+    REQUIRE(numbers.at(11) == 11);
+}
+
+TEST_CASE("robin hood static_map insert when full", "[static_map]")
+{
+    robin_hood_map<int, int, 3, colliding_hash> numbers = {{{1, 1}, {2, 2}, {11, 11}}};
+
+    REQUIRE(numbers.full());
+    REQUIRE(numbers.find(3) == numbers.end());
+    REQUIRE(!numbers.insert({3, 3}).second);
+    REQUIRE(numbers.at(1) == 1);
+    REQUIRE(numbers.at(2) == 2);
+    REQUIRE(numbers.at(11) == 11);
+}
+
+TEST_CASE("robin hood static_map with non trivial types", "[static_map]")
+{
+    robin_hood_map<std::string, std::string, 16> strings;
+
+    for(int i = 0; i < 16; ++i)
+        strings[std::to_string(i)] = std::string(32, static_cast<char>('a' + i));
+
+    for(int i = 0; i < 16; i += 2)
+        strings.erase(std::to_string(i));
+
+    REQUIRE(strings.size() == 8);
+    REQUIRE(strings.at("3") == std::string(32, 'd'));
+    REQUIRE(!strings.contains("4"));
+}
+
+template <typename key_type, typename mapped_type, size_t capacity, typename hash = std::hash<key_type>>
+using group_map = stc::static_map<key_type, mapped_type, capacity, hash, std::equal_to<key_type>, stc::group_probing>;
+
+TEST_CASE("group probing static_map storage and retrieval", "[static_map]")
+{
+    group_map<int, int, 37> numbers;
+
+    for(int i = 0; i < 37; ++i)
+        numbers[i * 3] = i;
+
+    REQUIRE(numbers.full());
+
+    for(int i = 0; i < 37; ++i)
+        REQUIRE(numbers.at(i * 3) == i);
+
+    REQUIRE(!numbers.contains(1));
+    REQUIRE(!numbers.insert({1, 1}).second);
+
+    size_t visited = 0;
+    for(const auto& entry : numbers)
+    {
+        REQUIRE(entry.first == entry.second * 3);
+        ++visited;
+    }
+
+    REQUIRE(visited == 37);
+}
+
+TEST_CASE("group probing static_map erase and reinsert", "[static_map]")
+{
+    group_map<int, int, 20, colliding_hash> numbers;
+
+    for(int i = 0; i < 20; ++i)
+        numbers[i] = i;
+
+    for(int i = 0; i < 20; i += 2)
+        numbers.erase(i);
+
+    REQUIRE(numbers.size() == 10);
+
+    for(int i = 0; i < 20; ++i)
+        REQUIRE(numbers.contains(i) == (i % 2 == 1));
+
+    for(int i = 100; i < 110; ++i)
+        numbers[i] = i;
+
+    REQUIRE(numbers.full());
+
+    for(int i = 100; i < 110; ++i)
+        REQUIRE(numbers.at(i) == i);
+}
+
+template <typename layout>
+void verify_group_erase_while_iterating()
+{
+    stc::static_map<int, int, 48, colliding_hash, std::equal_to<int>, stc::group_probing, stc::no_stats, layout> numbers;
+
+    for(int i = 0; i < 48; ++i)
+        numbers[i] = i;
+
+    //every group has been full, so erasing leaves tombstones, far more than half the empty slots
+    std::vector<int> visited;
+    for(auto iter = numbers.begin(); iter != numbers.end();)
+    {
+        int key = iter->first;
+        visited.push_back(key);
+
+        if(key % 8 != 0)
+            iter = numbers.erase(key);
+        else
+            ++iter;
+    }
+
+    std::sort(visited.begin(), visited.end());
+    std::vector<int> expected(48);
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(visited == expected);
+    REQUIRE(numbers.size() == 6);
+
+    for(int i = 0; i < 48; ++i)
+        REQUIRE(numbers.contains(i) == (i % 8 == 0));
+
+    //the first insertion drops the tombstones
+    for(int i = 100; i < 142; ++i)
+        REQUIRE(numbers.insert({i, i}).second);
+
+    REQUIRE(numbers.full());
+
+    for(int i = 100; i < 142; ++i)
+        REQUIRE(numbers.at(i) == i);
+
+    for(int i = 0; i < 48; i += 8)
+        REQUIRE(numbers.at(i) == i);
+
+    numbers.erase(100);
+    numbers.rehash();
+    REQUIRE(!numbers.contains(100));
+    REQUIRE(numbers.at(141) == 141);
+}
+
+TEST_CASE("group probing static_map erase while iterating visits every entry once", "[static_map]")
+{
+    verify_group_erase_while_iterating<stc::interleaved_layout>();
+    verify_group_erase_while_iterating<stc::split_layout>();
+}
+
+TEST_CASE("group probing static_map copy and move", "[static_map]")
+{
+    group_map<std::string, std::string, 24> strings;
+
+    for(int i = 0; i < 24; ++i)
+        strings[std::to_string(i)] = std::string(32, static_cast<char>('a' + i));
+
+    group_map<std::string, std::string, 24> copied = strings;
+    group_map<std::string, std::string, 24> moved = std::move(strings);
+
+    REQUIRE(strings.empty());
+    REQUIRE(copied.size() == 24);
+    REQUIRE(moved.size() == 24);
+    REQUIRE(copied.at("5") == std::string(32, 'f'));
+    REQUIRE(moved.at("5") == std::string(32, 'f'));
+
+    copied.clear();
+
+    REQUIRE(copied.empty());
+    REQUIRE(copied.begin() == copied.end());
+}
+
+TEST_CASE("static_map slots hold no occupancy flag", "[static_map]")
+{
+    using map_type = stc::static_map<int64_t, int64_t, 64>;
+
+    //the one byte size is padded up to the alignment of the bitmap words
+    REQUIRE(sizeof(map_type) == 64 * sizeof(map_type::value_type) + alignof(uint64_t) + sizeof(uint64_t));
+}
+
+TEST_CASE("static_map keeps its size in the smallest type that fits", "[static_map]")
+{
+    static_assert(sizeof(stc::static_map<uint8_t, uint8_t, 15>) == 40);
+    static_assert(sizeof(stc::static_map<int32_t, int32_t, 63>) == 520);
+    static_assert(sizeof(stc::static_map<int32_t, int32_t, 300>) == 2448);
+
+    stc::static_map<uint8_t, uint8_t, 255> numbers;
+    for(int i = 0; i < 255; ++i)
+        numbers.insert({static_cast<uint8_t>(i), static_cast<uint8_t>(i)});
+
+    REQUIRE(numbers.size() == 255);
+    REQUIRE(numbers.full());
+}
+
+TEST_CASE("static_map iteration skips empty slots", "[static_map]")
+{
+    stc::static_map<int, int, 200> numbers;
+
+    numbers[3] = 3;
+    numbers[64] = 64;
+    numbers[130] = 130;
+    numbers[199] = 199;
+
+    std::vector<int> visited;
+    for(const auto& entry : numbers)
+        visited.push_back(entry.first);
+
+    REQUIRE(visited == std::vector<int>{3, 64, 130, 199});
+
+    numbers.erase(64);
+    numbers.erase(3);
+
+    visited.clear();
+    for(const auto& entry : numbers)
+        visited.push_back(entry.first);
+
+    REQUIRE(visited == std::vector<int>{130, 199});
+}
+
+TEST_CASE("static_map collects operation statistics when asked to", "[static_map]")
+{
+    using plain_type = stc::static_map<int, int, 8, colliding_hash>;
+    using map_type = stc::static_map<int, int, 8, colliding_hash, std::equal_to<int>, stc::linear_probing, stc::collect_stats>;
+
+    static_assert(sizeof(plain_type) == sizeof(stc::static_map<int, int, 8, colliding_hash, std::equal_to<int>, stc::linear_probing, stc::no_stats>));
+
+    map_type numbers;
+
+    //0 to 9 share a home slot, so each insertion probes one slot further
+    for(int i = 0; i < 3; ++i)
+        REQUIRE(numbers.insert({i, i}).second);
+
+    const auto& stats = numbers.stats();
+    REQUIRE(stats.lookups == 3);
+    REQUIRE(stats.misses == 3);
+    REQUIRE(stats.max_probe_length == 3);
+    REQUIRE(stats.peak_size == 3);
+
+    REQUIRE(numbers.contains(2));
+    REQUIRE(!numbers.contains(5));
+    REQUIRE(numbers.at(0) == 0);
+    REQUIRE(stats.lookups == 6);
+    REQUIRE(stats.hits == 2);
+    REQUIRE(stats.misses == 4);
+    REQUIRE(stats.max_probe_length == 4);
+    REQUIRE(stats.average_probe_length() == Approx((1 + 2 + 3 + 3 + 4 + 1) / 6.0));
+
+    numbers.erase(1);
+    REQUIRE(stats.peak_size == 3);
+
+    for(int i = 10; i < 16; ++i)
+        numbers[i] = i;
+    REQUIRE(numbers.full());
+    REQUIRE(!numbers.insert({30, 30}).second);
+    REQUIRE(stats.insert_failures == 1);
+    REQUIRE_THROWS_AS(numbers[30], std::length_error);
+    REQUIRE(stats.insert_failures == 2);
+    REQUIRE(numbers.size() == 8);
+    REQUIRE(!numbers.contains(30));
+    REQUIRE(stats.peak_size == 8);
+
+    numbers.reset_stats();
+    REQUIRE(stats.lookups == 0);
+    REQUIRE(stats.peak_size == 8);
+
+    map_type copy = numbers;
+    REQUIRE(copy.stats().lookups == 0);
+}
+
+template <typename probing>
+void verify_transparent_lookup()
+{
+    //std::string has no implicit constructor from std::string_view, so these lookups cannot
+    //be building temporary keys
+    stc::static_map<std::string, int, 16, stc::string_hash, std::equal_to<>, probing> ids;
+    std::string_view alpha = "alpha";
+
+    ids[alpha] = 1;
+    ids[std::string("beta")] = 2;
+    ids["gamma"] = 3;
+
+    CHECK(ids.size() == 3);
+    CHECK(ids.find(alpha)->second == 1);
+    CHECK(ids.at(std::string_view("beta")) == 2);
+    CHECK(ids.contains("gamma"));
+    CHECK(ids.count(std::string_view("delta")) == 0);
+    CHECK(ids.find(std::string_view("delta")) == ids.end());
+
+    ids[alpha] += 10;
+    CHECK(ids.at("alpha") == 11);
+
+    ids.erase(std::string_view("beta"));
+    CHECK_FALSE(ids.contains(std::string_view("beta")));
+    CHECK(ids.size() == 2);
+
+    const auto& const_ids = ids;
+    CHECK(const_ids.find(std::string_view("gamma"))->second == 3);
+    CHECK(const_ids.at(std::string_view("gamma")) == 3);
+}
+
+TEST_CASE("static_map looks up keys by other types with a transparent hasher and key_equal", "[static_map]")
+{
+    verify_transparent_lookup<stc::linear_probing>();
+    verify_transparent_lookup<stc::robin_hood_probing>();
+    verify_transparent_lookup<stc::group_probing>();
+}
+
+template <typename probing>
+void verify_split_layout()
+{
+    using map_type = stc::static_map<std::string, std::string, 24, std::hash<std::string>, std::equal_to<std::string>, probing, stc::no_stats, stc::split_layout>;
+    map_type strings;
+
+    for(int i = 0; i < 24; ++i)
+        strings[std::to_string(i)] = std::string(32, static_cast<char>('a' + i));
+
+    CHECK(strings.full());
+    CHECK_FALSE(strings.insert({"24", "y"}).second);
+
+    for(int i = 0; i < 24; i += 2)
+        strings.erase(std::to_string(i));
+
+    CHECK(strings.size() == 12);
+    CHECK(strings.at("3") == std::string(32, 'd'));
+    CHECK_FALSE(strings.contains("4"));
+
+    auto inserted = strings.insert({"100", "hundred"});
+    CHECK(inserted.second);
+    CHECK(inserted.first->first == "100");
+    inserted.first->second += "!";
+    CHECK(strings.at("100") == "hundred!");
+
+    size_t visited = 0;
+    for(auto entry : strings)
+    {
+        entry.second = entry.first;
+        ++visited;
+    }
+    CHECK(visited == 13);
+    CHECK(strings.at("7") == "7");
+
+    typename map_type::value_type copied_entry = *strings.find("7");
+    CHECK(copied_entry.first == "7");
+
+    map_type copied = strings;
+    map_type moved = std::move(strings);
+
+    CHECK(strings.empty());
+    CHECK(copied.size() == 13);
+    CHECK(moved.at("100") == "100");
+
+    const map_type& const_moved = moved;
+    CHECK(const_moved.find("9")->second == "9");
+    CHECK((*const_moved.begin()).first == (*moved.begin()).first);
+}
+
+TEST_CASE("static_map can keep keys and mapped values in separate arrays", "[static_map]")
+{
+    verify_split_layout<stc::linear_probing>();
+    verify_split_layout<stc::robin_hood_probing>();
+    verify_split_layout<stc::group_probing>();
+
+    struct large
+    {
+        char bytes[256];
+    };
+
+    using map_type = stc::static_map<int, large, 8, colliding_hash, std::equal_to<int>, stc::linear_probing, stc::no_stats, stc::split_layout>;
+    map_type numbers;
+
+    //keys with neighbouring home slots are stored next to each other
+    numbers[1].bytes[0] = 1;
+    numbers[11].bytes[0] = 11;
+
+    REQUIRE(&numbers.find(11)->first - &numbers.find(1)->first == 1);
+    REQUIRE(numbers.at(11).bytes[0] == 11);
+    REQUIRE(sizeof(map_type) == sizeof(stc::static_map<int, large, 8, colliding_hash>));
+}
+
+template <typename key_type>
+void verify_scan_probing()
+{
+    stc::static_map<key_type, int, 40, std::hash<key_type>, std::equal_to<key_type>, stc::scan_probing> numbers;
+
+    for(int i = 0; i < 40; ++i)
+        numbers[static_cast<key_type>(i * 3)] = i;
+
+    CHECK(numbers.full());
+    CHECK_FALSE(numbers.insert({1, 1}).second);
+
+    for(int i = 0; i < 40; ++i)
+        CHECK(numbers.at(static_cast<key_type>(i * 3)) == i);
+
+    CHECK_FALSE(numbers.contains(1));
+    CHECK(numbers.find(2) == numbers.end());
+
+    //the last entry fills the hole, and erase returns it as the next entry to visit
+    auto after = numbers.erase(0);
+    CHECK(after->first == 39 * 3);
+    CHECK(numbers.size() == 39);
+
+    for(int i = 0; i < 40; i += 2)
+        numbers.erase(static_cast<key_type>(i * 3));
+
+    CHECK(numbers.size() == 20);
+
+    //erased keys are still in the key array past the size, and must not be found
+    for(int i = 0; i < 40; ++i)
+        CHECK(numbers.contains(static_cast<key_type>(i * 3)) == (i % 2 == 1));
+
+    size_t visited = 0;
+    for(const auto& entry : numbers)
+    {
+        CHECK(entry.first == static_cast<key_type>(entry.second * 3));
+        ++visited;
+    }
+    CHECK(visited == 20);
+
+    auto copied = numbers;
+    numbers.clear();
+    CHECK(numbers.empty());
+    CHECK_FALSE(numbers.contains(3));
+    CHECK(copied.at(3) == 1);
+}
+
+TEST_CASE("scan probing static_map compares blocks of keys", "[static_map]")
+{
+    verify_scan_probing<uint8_t>();
+    verify_scan_probing<int16_t>();
+    verify_scan_probing<int32_t>();
+    verify_scan_probing<uint64_t>();
+
+    //negative keys must not match their unsigned bit pattern in another width
+    stc::static_map<int64_t, int, 8, std::hash<int64_t>, std::equal_to<int64_t>, stc::scan_probing> wide;
+    wide[-1] = 1;
+    wide[int64_t(0xffffffff)] = 2;
+    wide[int64_t(0xffffffff) << 32] = 3;
+
+    REQUIRE(wide.at(-1) == 1);
+    REQUIRE(wide.at(int64_t(0xffffffff)) == 2);
+    REQUIRE(wide.at(int64_t(0xffffffff) << 32) == 3);
+    REQUIRE_FALSE(wide.contains(int64_t(0xffffffff00)));
+
+    stc::static_map<int, std::string, 64, std::hash<int>, std::equal_to<int>, stc::scan_probing> names;
+    for(int i = 0; i < 64; ++i)
+        names[i] = std::to_string(i);
+
+    REQUIRE(names.probe_length(63) == 64 / stc::key_block<int>::width);
+    REQUIRE(names.at(63) == "63");
+    names.erase(10);
+    REQUIRE(names.at(63) == "63");
+    REQUIRE(names.find(10) == names.end());
+}
@@ -0,0 +1,141 @@
+#include "common.hpp"
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stc/static_mpmc_queue.hpp>
+
+TEST_CASE("static_mpmc_queue hands out elements in push order", "[static_mpmc_queue]")
+{
+    stc::static_mpmc_queue<std::string, 3> words;
+    std::string popped;
+
+    REQUIRE(words.empty());
+    REQUIRE_FALSE(words.try_pop(popped));
+
+    REQUIRE(words.try_push("a"));
+    REQUIRE(words.try_emplace(2, 'b'));
+    words.push("c");
+    REQUIRE_FALSE(words.try_push("d"));
+    REQUIRE(words.size() == 3);
+
+    REQUIRE(words.try_pop(popped));
+    REQUIRE(popped == "a");
+    words.emplace("d");
+
+    //wrapped around the end of the storage many times
+    for(int i = 0; i < 100; ++i)
+    {
+        words.pop(popped);
+        REQUIRE(words.try_push(std::to_string(i)));
+    }
+
+    REQUIRE(words.try_pop(popped));
+    REQUIRE(popped == "97");
+    REQUIRE(words.try_pop(popped));
+    REQUIRE(words.try_pop(popped));
+    REQUIRE(popped == "99");
+    REQUIRE(words.empty());
+}
+
+TEST_CASE("static_mpmc_queue of the smallest capacity refuses pushes when full", "[static_mpmc_queue]")
+{
+    stc::static_mpmc_queue<int, 2> numbers;
+    int popped = 0;
+
+    for(int lap = 0; lap < 5; ++lap)
+    {
+        REQUIRE(numbers.try_push(lap));
+        REQUIRE(numbers.try_push(lap + 10));
+        REQUIRE_FALSE(numbers.try_push(lap + 20));
+        REQUIRE(numbers.size() == 2);
+
+        REQUIRE(numbers.try_pop(popped));
+        REQUIRE(popped == lap);
+        REQUIRE(numbers.try_pop(popped));
+        REQUIRE(popped == lap + 10);
+        REQUIRE_FALSE(numbers.try_pop(popped));
+        REQUIRE(numbers.empty());
+    }
+}
+
+TEST_CASE("static_mpmc_queue constructs and destroys each element once", "[static_mpmc_queue]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    //the two elements left are destroyed with the queue
+    stc::static_mpmc_queue<probe, 4> probes;
+
+    verify_semantics<probe>(semantics_flags::NoCopy, [&probes]()
+    {
+        for(int i = 0; i < 3; ++i)
+            probes.try_emplace(i);
+    });
+
+    probe popped;
+    REQUIRE(probes.try_pop(popped));
+    REQUIRE(popped == 0);
+}
+
+TEST_CASE("static_mpmc_queue passes every element exactly once between many threads", "[static_mpmc_queue]")
+{
+    constexpr int producer_count = 4;
+    constexpr int consumer_count = 3;
+    constexpr int per_producer = 20000;
+    stc::static_mpmc_queue<int, 50> numbers;
+
+    std::vector<std::thread> threads;
+    std::vector<std::vector<int>> received(consumer_count);
+
+    for(int producer = 0; producer < producer_count; ++producer)
+    {
+        threads.emplace_back([&numbers, producer]()
+        {
+            for(int i = 0; i < per_producer; ++i)
+                numbers.push(producer * per_producer + i);
+        });
+    }
+
+    for(int consumer = 0; consumer < consumer_count; ++consumer)
+    {
+        threads.emplace_back([&numbers, &received, consumer]()
+        {
+            int share = producer_count * per_producer / consumer_count + (consumer == 0 ? producer_count * per_producer % consumer_count : 0);
+            int value = 0;
+
+            for(int i = 0; i < share; ++i)
+            {
+                numbers.pop(value);
+                received[consumer].push_back(value);
+            }
+        });
+    }
+
+    for(std::thread& thread : threads)
+        thread.join();
+
+    REQUIRE(numbers.empty());
+
+    //each consumer sees the elements of one producer in the order they were pushed
+    bool in_order = true;
+    std::vector<int> all;
+    for(const std::vector<int>& values : received)
+    {
+        std::vector<int> last(producer_count, -1);
+        for(int value : values)
+        {
+            in_order = in_order && value > last[value / per_producer];
+            last[value / per_producer] = value;
+        }
+
+        all.insert(all.end(), values.begin(), values.end());
+    }
+
+    REQUIRE(in_order);
+
+    std::sort(all.begin(), all.end());
+    REQUIRE(all.size() == producer_count * per_producer);
+    for(size_t i = 0; i < all.size(); ++i)
+        REQUIRE(all[i] == static_cast<int>(i));
+}
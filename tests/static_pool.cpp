@@ -0,0 +1,146 @@
+#include "common.hpp"
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <stc/static_object_pool.hpp>
+#include <stc/static_pool_resource.hpp>
+
+TEST_CASE("static_pool_resource backs std::pmr containers", "[static_pool_resource]")
+{
+    stc::static_pool_resource<65536> pool;
+
+    {
+        std::pmr::list<int> numbers(&pool);
+        std::pmr::map<int, std::pmr::string> names(&pool);
+
+        for(int i = 0; i < 100; ++i)
+        {
+            numbers.push_back(i);
+            names.emplace(i, "a string too long for sso " + std::to_string(i));
+        }
+
+        numbers.remove_if([](int value) { return value % 2 == 0; });
+        REQUIRE(numbers.size() == 50);
+        REQUIRE(names.at(42) == "a string too long for sso 42");
+    }
+
+    //freed nodes are reused rather than cut from the buffer again
+    size_t used = pool.used();
+    {
+        std::pmr::list<int> numbers(&pool);
+        for(int i = 0; i < 100; ++i)
+            numbers.push_back(i);
+    }
+    REQUIRE(pool.used() == used);
+
+    REQUIRE(pool.is_equal(pool));
+    stc::static_pool_resource<64> other;
+    REQUIRE_FALSE(pool.is_equal(other));
+}
+
+TEST_CASE("static_pool_resource reuses blocks of the same size class", "[static_pool_resource]")
+{
+    stc::static_pool_resource<256> pool;
+
+    void* a = pool.allocate(24, 8);
+    void* b = pool.allocate(32, 8);
+    REQUIRE(pool.used() == 64);
+
+    pool.deallocate(a, 24, 8);
+    void* c = pool.allocate(17, 8);
+    REQUIRE(c == a);
+
+    void* aligned = pool.allocate(8, 64);
+    REQUIRE(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+
+    REQUIRE_THROWS_AS(pool.allocate(512, 8), std::bad_alloc);
+    REQUIRE_THROWS_AS(pool.allocate(256, 8), std::bad_alloc);
+
+    pool.deallocate(b, 32, 8);
+    pool.deallocate(c, 17, 8);
+    pool.deallocate(aligned, 8, 64);
+
+    pool.release();
+    REQUIRE(pool.used() == 0);
+    REQUIRE(pool.allocate(256, 8) != nullptr);
+}
+
+#if STC_POOL_POISONING && !defined(STC_ASAN)
+TEST_CASE("static_pool_resource poisons freed memory", "[static_pool_resource]")
+{
+    stc::static_pool_resource<256> pool;
+
+    unsigned char* block = static_cast<unsigned char*>(pool.allocate(32, 8));
+    std::memset(block, 0, 32);
+    pool.deallocate(block, 32, 8);
+
+    //the first bytes link the free list
+    for(size_t i = sizeof(void*); i < 32; ++i)
+        REQUIRE(block[i] == stc::freed_memory_pattern);
+}
+#endif
+
+TEST_CASE("static_object_pool creates and destroys objects in any order", "[static_object_pool]")
+{
+    stc::static_object_pool<std::string, 3> words;
+
+    std::string* a = words.create("a");
+    std::string* b = words.create(2, 'b');
+    std::string* c = words.create("c");
+
+    REQUIRE(words.full());
+    REQUIRE(words.create("d") == nullptr);
+    REQUIRE(*b == "bb");
+    REQUIRE(words.owns(a));
+
+    words.destroy(b);
+    REQUIRE_FALSE(words.owns(b));
+    REQUIRE(words.size() == 2);
+
+    std::string* d = words.create("d");
+    REQUIRE(d == b);
+    REQUIRE(*a == "a");
+    REQUIRE(*c == "c");
+    REQUIRE(*d == "d");
+
+    std::string outside;
+    REQUIRE_FALSE(words.owns(&outside));
+
+    words.destroy(a);
+    words.destroy(c);
+    words.destroy(d);
+    REQUIRE(words.empty());
+}
+
+TEST_CASE("static_object_pool constructs and destroys each object once", "[static_object_pool]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    //the objects left are destroyed with the pool
+    stc::static_object_pool<probe, 8> probes;
+    std::vector<probe*> created;
+
+    verify_semantics<probe>(semantics_flags::NoCopy | semantics_flags::NoMove, [&]()
+    {
+        for(int i = 0; i < 8; ++i)
+            created.push_back(probes.create(i));
+    });
+
+    probes.destroy(created[3]);
+    probes.destroy(created[0]);
+    REQUIRE(*probes.create(9) == 9);
+    REQUIRE(*created[7] == 7);
+
+    //small objects still have room for the free list link
+    stc::static_object_pool<char, 300> letters;
+    std::vector<char*> taken;
+    for(int i = 0; i < 300; ++i)
+        taken.push_back(letters.create(static_cast<char>('a' + i % 26)));
+    for(char* letter : taken)
+        letters.destroy(letter);
+    REQUIRE(*letters.create('z') == 'z');
+}
@@ -0,0 +1,203 @@
+#include "common.hpp"
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <string>
+#include <stc/static_ring.hpp>
+
+template <typename ring_type>
+void verify_contains(const ring_type& ring, std::initializer_list<typename ring_type::value_type> contents)
+{
+    REQUIRE(ring.size() == contents.size());
+    REQUIRE(ring.empty() == (contents.size() == 0));
+    REQUIRE(std::equal(ring.begin(), ring.end(), contents.begin()));
+    REQUIRE(std::equal(ring.rbegin(), ring.rend(), std::rbegin(contents)));
+
+    size_t i = 0;
+    for(const auto& item : contents)
+    {
+        REQUIRE(ring[i] == item);
+        REQUIRE(ring.at(i) == item);
+        REQUIRE(*(ring.begin() + i) == item);
+        ++i;
+    }
+
+    REQUIRE_THROWS_AS(ring.at(contents.size()), std::out_of_range);
+}
+
+TEST_CASE("static_ring pushes and pops at both ends", "[static_ring]")
+{
+    stc::static_ring<int, 4> numbers;
+
+    numbers.push_back(1);
+    numbers.push_back(2);
+    numbers.push_front(0);
+    verify_contains(numbers, {0, 1, 2});
+    REQUIRE(numbers.front() == 0);
+    REQUIRE(numbers.back() == 2);
+
+    numbers.pop_front();
+    numbers.push_back(3);
+    numbers.push_back(4);
+    REQUIRE(numbers.full());
+    verify_contains(numbers, {1, 2, 3, 4});
+
+    numbers.pop_back();
+    numbers.pop_front();
+    numbers.push_front(9);
+    verify_contains(numbers, {9, 2, 3});
+
+    numbers.clear();
+    verify_contains(numbers, {});
+}
+
+TEST_CASE("static_ring iterators wrap around the end of the storage", "[static_ring]")
+{
+    stc::static_ring<int, 5> numbers{1, 2, 3, 4, 5};
+
+    numbers.pop_front();
+    numbers.pop_front();
+    numbers.push_back(6);
+    numbers.push_back(7);
+
+    verify_contains(numbers, {3, 4, 5, 6, 7});
+
+    auto begin = numbers.begin();
+    auto end = numbers.end();
+    REQUIRE(end - begin == 5);
+    REQUIRE(begin[4] == 7);
+    REQUIRE(*(end - 2) == 6);
+    REQUIRE(begin < end);
+
+    std::sort(numbers.begin(), numbers.end(), std::greater<int>());
+    verify_contains(numbers, {7, 6, 5, 4, 3});
+
+    stc::static_ring<int, 5>::const_iterator converted = numbers.begin();
+    REQUIRE(*converted == 7);
+}
+
+TEST_CASE("static_ring with overwrite_oldest keeps the latest elements", "[static_ring]")
+{
+    stc::static_ring<int, 3, stc::overwrite_oldest> window;
+
+    for(int i = 1; i <= 7; ++i)
+        window.push_back(i);
+
+    verify_contains(window, {5, 6, 7});
+
+    window.push_front(0);
+    verify_contains(window, {0, 5, 6});
+}
+
+TEST_CASE("static_ring with overwrite_oldest can take the element it drops", "[static_ring]")
+{
+    //long enough to live on the heap, so reading a destroyed string would be caught
+    std::string first(64, 'a');
+    std::string second(64, 'b');
+    std::string third(64, 'c');
+    stc::static_ring<std::string, 3, stc::overwrite_oldest> names;
+
+    names.push_back(first);
+    names.push_back(second);
+    names.push_back(third);
+
+    names.push_back(names.front());
+    verify_contains(names, {second, third, first});
+
+    names.emplace_back(std::move(names.front()));
+    verify_contains(names, {third, first, second});
+
+    names.push_front(names.back());
+    verify_contains(names, {second, third, first});
+
+    names.emplace_front(std::move(names.back()));
+    verify_contains(names, {first, second, third});
+}
+
+TEST_CASE("static_ring matches std::deque under random use", "[static_ring]")
+{
+    stc::static_ring<int, 12> ring;
+    stc::static_ring<int, 16> masked_ring;
+    std::deque<int> reference;
+    std::mt19937 random(7);
+
+    for(int step = 0; step < 10000; ++step)
+    {
+        int value = static_cast<int>(random() % 1000);
+
+        switch(random() % 4)
+        {
+            case 0:
+                if(!ring.full())
+                {
+                    ring.push_back(value);
+                    masked_ring.push_back(value);
+                    reference.push_back(value);
+                }
+                break;
+            case 1:
+                if(!ring.full())
+                {
+                    ring.push_front(value);
+                    masked_ring.push_front(value);
+                    reference.push_front(value);
+                }
+                break;
+            case 2:
+                if(!ring.empty())
+                {
+                    ring.pop_front();
+                    masked_ring.pop_front();
+                    reference.pop_front();
+                }
+                break;
+            default:
+                if(!ring.empty())
+                {
+                    ring.pop_back();
+                    masked_ring.pop_back();
+                    reference.pop_back();
+                }
+                break;
+        }
+
+        REQUIRE(ring.size() == reference.size());
+        REQUIRE(std::equal(ring.begin(), ring.end(), reference.begin()));
+        REQUIRE(std::equal(masked_ring.begin(), masked_ring.end(), reference.begin()));
+    }
+}
+
+TEST_CASE("static_ring constructs and destroys each element once", "[static_ring]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    stc::static_ring<probe, 4, stc::overwrite_oldest> probes;
+
+    verify_semantics<probe>(semantics_flags::NoCopy, [&probes]()
+    {
+        for(int i = 0; i < 6; ++i)
+            probes.emplace_back(i);
+    });
+
+    //each overwrite destroys the oldest element and the temporary the new one was moved from
+    REQUIRE(probe::total().destr == 4);
+    REQUIRE(probes.front() == 2);
+
+    stc::static_ring<probe, 4, stc::overwrite_oldest> copy(probes);
+    stc::static_ring<probe, 4, stc::overwrite_oldest> moved(std::move(probes));
+
+    REQUIRE(copy == moved);
+    REQUIRE(probes.empty());
+}
+
+TEST_CASE("static_ring keeps its positions in the smallest type that fits", "[static_ring]")
+{
+    static_assert(sizeof(stc::static_ring<uint8_t, 14>) == 16);
+    static_assert(sizeof(stc::static_ring<int32_t, 1000>) == 4004);
+
+    stc::static_ring<std::string, 2> words{"a", "b"};
+    words.pop_front();
+    words.emplace_back(3, 'c');
+    REQUIRE(words.back() == "ccc");
+}
@@ -0,0 +1,123 @@
+#include "common.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stc/static_slot_map.hpp>
+
+TEST_CASE("static_slot_map handles stay valid until their element is erased", "[static_slot_map]")
+{
+    stc::static_slot_map<std::string, 4> names;
+
+    auto a = names.insert("a");
+    auto b = names.emplace(2, 'b');
+    auto c = names.insert("c");
+
+    REQUIRE(names.size() == 3);
+    REQUIRE(names[a] == "a");
+    REQUIRE(names.at(b) == "bb");
+    REQUIRE(*names.find(c) == "c");
+
+    //the last element moves into the hole and keeps its handle
+    REQUIRE(names.erase(a));
+    REQUIRE_FALSE(names.erase(a));
+    REQUIRE_FALSE(names.contains(a));
+    REQUIRE(names.find(a) == nullptr);
+    REQUIRE_THROWS_AS(names.at(a), std::out_of_range);
+    REQUIRE(names[c] == "c");
+    REQUIRE(names[b] == "bb");
+    REQUIRE(std::vector<std::string>(names.begin(), names.end()) == std::vector<std::string>{"c", "bb"});
+
+    //the freed slot is reused with a new generation
+    auto d = names.insert("d");
+    REQUIRE(d.index == a.index);
+    REQUIRE(d != a);
+    REQUIRE_FALSE(names.contains(a));
+    REQUIRE(names[d] == "d");
+
+    for(size_t i = 0; i < names.size(); ++i)
+        REQUIRE(names[names.handle_at(i)] == names.data()[i]);
+
+    REQUIRE_FALSE(names.contains(stc::slot_map_handle{}));
+
+    names.clear();
+    REQUIRE(names.empty());
+    REQUIRE_FALSE(names.contains(b));
+    REQUIRE_FALSE(names.contains(d));
+
+    auto e = names.insert("e");
+    REQUIRE(names.size() == 1);
+    REQUIRE(names[e] == "e");
+}
+
+TEST_CASE("static_slot_map matches a map of handles under random use", "[static_slot_map]")
+{
+    stc::static_slot_map<int, 50> numbers;
+    std::unordered_map<uint32_t, std::pair<stc::slot_map_handle, int>> reference;
+    std::vector<stc::slot_map_handle> stale;
+    std::mt19937 random(11);
+
+    for(int step = 0; step < 20000; ++step)
+    {
+        if(!numbers.full() && (reference.empty() || random() % 2 == 0))
+        {
+            int value = static_cast<int>(random());
+            auto h = numbers.insert(value);
+            REQUIRE(reference.count(h.index) == 0);
+            reference[h.index] = {h, value};
+        }
+        else
+        {
+            auto erased = std::next(reference.begin(), static_cast<std::ptrdiff_t>(random() % reference.size()));
+            REQUIRE(numbers.erase(erased->second.first));
+            stale.push_back(erased->second.first);
+            reference.erase(erased);
+        }
+
+        REQUIRE(numbers.size() == reference.size());
+    }
+
+    for(const auto& [index, entry] : reference)
+        REQUIRE(numbers[entry.first] == entry.second);
+
+    for(const auto& h : stale)
+        REQUIRE_FALSE(numbers.contains(h));
+
+    std::vector<int> values(numbers.begin(), numbers.end());
+    std::vector<int> expected;
+    for(const auto& [index, entry] : reference)
+        expected.push_back(entry.second);
+    std::sort(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(values == expected);
+}
+
+TEST_CASE("static_slot_map constructs and destroys each element once", "[static_slot_map]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    stc::static_slot_map<probe, 4> probes;
+    std::vector<stc::slot_map_handle> handles;
+
+    verify_semantics<probe>(semantics_flags::NoCopy, [&]()
+    {
+        for(int i = 0; i < 4; ++i)
+            handles.push_back(probes.emplace(i));
+    });
+
+    probes.erase(handles[1]);
+    REQUIRE(probes[handles[3]] == 3);
+
+    stc::static_slot_map<probe, 4> copy(probes);
+    stc::static_slot_map<probe, 4> moved(std::move(probes));
+
+    REQUIRE(probes.empty());
+    REQUIRE(copy[handles[0]] == 0);
+    REQUIRE(moved[handles[3]] == 3);
+    REQUIRE_FALSE(moved.contains(handles[1]));
+
+    copy = moved;
+    REQUIRE(copy.size() == 3);
+}
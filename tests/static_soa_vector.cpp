@@ -0,0 +1,110 @@
+#include "common.hpp"
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <stc/static_soa_vector.hpp>
+
+TEST_CASE("static_soa_vector keeps its columns in sync", "[static_soa_vector]")
+{
+    stc::static_soa_vector<8, int, std::string, double> orders;
+
+    orders.emplace_back(1, "one", 1.5);
+    orders.push_back({2, "two", 2.5});
+    std::tuple<int, std::string, double> third{3, "three", 3.5};
+    orders.push_back(third);
+    orders.emplace_back(4, "four", 4.5);
+
+    REQUIRE(orders.size() == 4);
+    REQUIRE(std::get<1>(orders[1]) == "two");
+    REQUIRE(std::get<0>(orders.back()) == 4);
+    REQUIRE(std::get<2>(orders.at(2)) == 3.5);
+    REQUIRE_THROWS_AS(orders.at(4), std::out_of_range);
+
+    //elements are references to their fields
+    std::get<1>(orders.front()) = "uno";
+    REQUIRE(orders.data<1>()[0] == "uno");
+
+    auto after = orders.erase(orders.begin() + 1);
+    REQUIRE(std::get<0>(*after) == 3);
+    REQUIRE(std::vector<int>(orders.column<0>().begin(), orders.column<0>().end()) == std::vector<int>{1, 3, 4});
+    REQUIRE(std::vector<std::string>(orders.column<1>().begin(), orders.column<1>().end()) == std::vector<std::string>{"uno", "three", "four"});
+
+    after = orders.erase_unordered(orders.begin());
+    REQUIRE(std::get<1>(*after) == "four");
+    REQUIRE(orders.size() == 2);
+    REQUIRE(std::get<2>(orders[1]) == 3.5);
+
+    std::tuple<int, std::string, double> copied = orders[0];
+    REQUIRE(std::get<1>(copied) == "four");
+
+    orders.resize(4);
+    REQUIRE(std::get<0>(orders[3]) == 0);
+    REQUIRE(std::get<1>(orders[3]).empty());
+
+    int visited = 0;
+    for(auto order : orders)
+    {
+        std::get<0>(order) += 10;
+        ++visited;
+    }
+    REQUIRE(visited == 4);
+    REQUIRE(orders.column<0>()[1] == 13);
+
+    const auto& const_orders = orders;
+    REQUIRE(std::get<1>(*const_orders.begin()) == "four");
+    REQUIRE(const_orders.end() - const_orders.begin() == 4);
+
+    orders.pop_back();
+    orders.clear();
+    REQUIRE(orders.empty());
+}
+
+TEST_CASE("static_soa_vector columns are aligned arrays", "[static_soa_vector]")
+{
+    stc::static_soa_vector<100, float, float, uint8_t> particles;
+
+    for(int i = 0; i < 100; ++i)
+        particles.emplace_back(static_cast<float>(i), 1.0f, static_cast<uint8_t>(i % 3));
+
+    REQUIRE(particles.full());
+    REQUIRE(reinterpret_cast<uintptr_t>(particles.data<0>()) % stc::cache_line_size == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(particles.data<1>()) % stc::cache_line_size == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(particles.data<2>()) % stc::cache_line_size == 0);
+
+    auto positions = particles.column<0>();
+    auto velocities = particles.column<1>();
+    for(size_t i = 0; i < positions.size(); ++i)
+        positions[i] += velocities[i];
+
+    REQUIRE(std::accumulate(positions.begin(), positions.end(), 0.0f) == 5050.0f);
+    REQUIRE(particles.column<2>().size() == 100);
+}
+
+TEST_CASE("static_soa_vector constructs and destroys each field once", "[static_soa_vector]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    stc::static_soa_vector<8, probe, int> probes;
+
+    verify_semantics<probe>(semantics_flags::NoCopy | semantics_flags::NoMove, [&]()
+    {
+        for(int i = 0; i < 8; ++i)
+            probes.emplace_back(i, i);
+    });
+
+    auto copied = probes;
+    auto moved = std::move(copied);
+    REQUIRE(copied.empty());
+    REQUIRE(moved.size() == 8);
+
+    moved.erase(moved.begin() + 2, moved.begin() + 5);
+    REQUIRE(moved.size() == 5);
+    REQUIRE(moved.data<0>()[2] == 5);
+    REQUIRE(moved.column<1>()[4] == 7);
+
+    probes = moved;
+    REQUIRE(probes.size() == 5);
+}
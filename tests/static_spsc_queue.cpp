@@ -0,0 +1,130 @@
+#include "common.hpp"
+#include <algorithm>
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stc/static_spsc_queue.hpp>
+
+TEST_CASE("static_spsc_queue hands out elements in push order", "[static_spsc_queue]")
+{
+    stc::static_spsc_queue<int, 3> numbers;
+    int popped = 0;
+
+    REQUIRE(numbers.empty());
+    REQUIRE_FALSE(numbers.try_pop(popped));
+
+    REQUIRE(numbers.try_push(1));
+    REQUIRE(numbers.try_push(2));
+    REQUIRE(numbers.try_emplace(3));
+    REQUIRE_FALSE(numbers.try_push(4));
+    REQUIRE(numbers.size() == 3);
+
+    REQUIRE(numbers.try_pop(popped));
+    REQUIRE(popped == 1);
+    REQUIRE(numbers.try_push(4));
+
+    //wrapped around the end of the storage many times
+    for(int i = 5; i < 100; ++i)
+    {
+        REQUIRE(numbers.try_pop(popped));
+        REQUIRE(popped == i - 3);
+        REQUIRE(numbers.try_push(i));
+    }
+
+    for(int i = 97; i < 100; ++i)
+    {
+        REQUIRE(numbers.try_pop(popped));
+        REQUIRE(popped == i);
+    }
+
+    REQUIRE(numbers.empty());
+}
+
+TEST_CASE("static_spsc_queue pushes and pops in batches", "[static_spsc_queue]")
+{
+    stc::static_spsc_queue<std::string, 8> words;
+    std::vector<std::string> input = {"a", "b", "c", "d", "e", "f"};
+    std::array<std::string, 8> output;
+
+    REQUIRE(words.try_push_n(input.begin(), input.size()) == 6);
+    REQUIRE(words.try_pop_n(output.begin(), 4) == 4);
+    REQUIRE(output[0] == "a");
+    REQUIRE(output[3] == "d");
+
+    //only the free slots are filled
+    REQUIRE(words.try_push_n(input.begin(), input.size()) == 6);
+    REQUIRE(words.try_push_n(input.begin(), input.size()) == 0);
+
+    REQUIRE(words.try_pop_n(output.begin(), output.size()) == 8);
+    REQUIRE(output[0] == "e");
+    REQUIRE(output[1] == "f");
+    REQUIRE(output[2] == "a");
+    REQUIRE(output[7] == "f");
+    REQUIRE(words.try_pop_n(output.begin(), output.size()) == 0);
+}
+
+TEST_CASE("static_spsc_queue constructs and destroys each element once", "[static_spsc_queue]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    //the two elements left are destroyed with the queue
+    stc::static_spsc_queue<probe, 4> probes;
+
+    verify_semantics<probe>(semantics_flags::NoCopy, [&probes]()
+    {
+        for(int i = 0; i < 3; ++i)
+            probes.try_emplace(i);
+    });
+
+    probe popped;
+    REQUIRE(probes.try_pop(popped));
+    REQUIRE(popped == 0);
+}
+
+TEST_CASE("static_spsc_queue passes every element between two threads in order", "[static_spsc_queue]")
+{
+    constexpr int count = 200000;
+    stc::static_spsc_queue<int, 64> numbers;
+
+    std::thread producer([&numbers]()
+    {
+        std::array<int, 16> batch;
+        int next = 0;
+
+        while(next < count)
+        {
+            if(next % 3 == 0)
+            {
+                if(numbers.try_push(next))
+                    ++next;
+            }
+            else
+            {
+                size_t batch_size = std::min<size_t>(batch.size(), static_cast<size_t>(count - next));
+                for(size_t i = 0; i < batch_size; ++i)
+                    batch[i] = next + static_cast<int>(i);
+
+                next += static_cast<int>(numbers.try_push_n(batch.begin(), batch_size));
+            }
+        }
+    });
+
+    bool in_order = true;
+    std::array<int, 8> batch;
+    int expected = 0;
+
+    while(expected < count)
+    {
+        size_t popped = numbers.try_pop_n(batch.begin(), expected % 2 == 0 ? 1 : batch.size());
+
+        for(size_t i = 0; i < popped; ++i)
+            in_order = in_order && batch[i] == expected++;
+    }
+
+    producer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(numbers.empty());
+}
@@ -0,0 +1,146 @@
+#include "common.hpp"
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <stc/static_map.hpp>
+#include <stc/static_string.hpp>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+TEST_CASE("static_string takes capacity plus one characters", "[static_string]")
+{
+    static_assert(sizeof(stc::static_string<15>) == 16);
+    static_assert(sizeof(stc::static_string<255>) == 256);
+    static_assert(sizeof(stc::static_wstring<7>) == 8 * sizeof(wchar_t));
+    static_assert(std::is_trivially_copyable_v<stc::static_string<15>>);
+
+    //too long for the length to fit in the last char
+    static_assert(sizeof(stc::static_string<256>) == 260);
+
+    constexpr stc::static_string<8> empty;
+    static_assert(empty.empty() && empty.size() == 0);
+}
+
+TEST_CASE("static_string keeps its characters null terminated", "[static_string]")
+{
+    stc::static_string<5> text;
+    REQUIRE(std::strcmp(text.c_str(), "") == 0);
+
+    text = "abc";
+    REQUIRE(text.size() == 3);
+    REQUIRE(std::strcmp(text.c_str(), "abc") == 0);
+
+    //full, the terminator is the length byte
+    text += "de";
+    REQUIRE(text.full());
+    REQUIRE(std::strcmp(text.c_str(), "abcde") == 0);
+    REQUIRE(text.back() == 'e');
+
+    text.pop_back();
+    REQUIRE(std::strcmp(text.c_str(), "abcd") == 0);
+
+    text.erase(1, 2);
+    REQUIRE(text == "ad");
+    REQUIRE(std::strcmp(text.c_str(), "ad") == 0);
+
+    text.resize(4, 'x');
+    REQUIRE(text == "adxx");
+    text.resize(1);
+    REQUIRE(text == "a");
+
+    text.clear();
+    REQUIRE(text.empty());
+    REQUIRE(text.c_str()[0] == '\0');
+
+    stc::static_string<300> wide(300, 'w');
+    REQUIRE(wide.size() == 300);
+    REQUIRE(std::strlen(wide.c_str()) == 300);
+}
+
+TEST_CASE("static_string throws rather than grow past its capacity", "[static_string]")
+{
+    stc::static_string<4> text("abcd");
+
+    REQUIRE_THROWS_AS(text.push_back('e'), std::length_error);
+    REQUIRE_THROWS_AS(text.append("e"), std::length_error);
+    REQUIRE_THROWS_AS(stc::static_string<2>("abc"), std::length_error);
+    REQUIRE_THROWS_AS(text.at(4), std::out_of_range);
+    REQUIRE_THROWS_AS(text.substr(5), std::out_of_range);
+    REQUIRE(text == "abcd");
+
+    text.resize(2);
+    REQUIRE_FALSE(text.append_truncated("xyz"));
+    REQUIRE(text == "abxy");
+    REQUIRE(text.append_truncated(""));
+
+    text.resize(1);
+    REQUIRE(text.append_truncated("xyz"));
+    REQUIRE(text == "axyz");
+}
+
+TEST_CASE("static_string searches and compares like std::string_view", "[static_string]")
+{
+    stc::static_string<32> path("/usr/local/include");
+
+    REQUIRE(path.find('/') == 0);
+    REQUIRE(path.find("local") == 5);
+    REQUIRE(path.rfind('/') == 10);
+    REQUIRE(path.find("missing") == path.npos);
+    REQUIRE(path.starts_with("/usr"));
+    REQUIRE(path.ends_with("include"));
+    REQUIRE(path.ends_with('e'));
+    REQUIRE_FALSE(path.starts_with("usr"));
+    REQUIRE(path.contains("local"));
+    REQUIRE(path.substr(5, 5) == "local");
+
+    std::string_view view = path;
+    REQUIRE(view == "/usr/local/include"sv);
+    REQUIRE(std::string(path) == "/usr/local/include"s);
+
+    stc::static_string<8> a("abc");
+    stc::static_string<8> b("abd");
+    stc::static_string<16> c("abc");
+
+    REQUIRE(a < b);
+    REQUIRE(b > a);
+    REQUIRE(a <= c);
+    REQUIRE(a >= "abc"sv);
+    REQUIRE(a == c);
+    REQUIRE(a != b);
+    REQUIRE("abc" == a);
+    REQUIRE(a.compare("abb") > 0);
+}
+
+TEST_CASE("static_string works as a hash map key", "[static_string]")
+{
+    stc::static_map<stc::static_string<15>, int, 16> ids;
+
+    ids[stc::static_string<15>("alpha")] = 1;
+    ids[stc::static_string<15>("beta")] = 2;
+
+    REQUIRE(ids.at(stc::static_string<15>("alpha")) == 1);
+    REQUIRE(ids.contains(stc::static_string<15>("beta")));
+    REQUIRE_FALSE(ids.contains(stc::static_string<15>("gamma")));
+
+    std::unordered_set<stc::static_string<15>> names{stc::static_string<15>("x"), stc::static_string<15>("y")};
+    REQUIRE(names.count(stc::static_string<15>("x")) == 1);
+    REQUIRE(std::hash<stc::static_string<15>>{}(stc::static_string<15>("x")) == std::hash<std::string_view>{}("x"));
+}
+
+TEST_CASE("static_string keyed maps can be searched with string views", "[static_string]")
+{
+    using key = stc::static_string<15>;
+    stc::static_map<key, int, 16, std::hash<key>, std::equal_to<>> ids;
+
+    ids["alpha"sv] = 1;
+    ids[key("beta")] = 2;
+
+    REQUIRE(ids.at("alpha"sv) == 1);
+    REQUIRE(ids.contains("beta"sv));
+    REQUIRE_FALSE(ids.contains("gamma"sv));
+    ids.erase("alpha"sv);
+    REQUIRE(ids.size() == 1);
+}
@@ -1,5 +1,9 @@
 #include "common.hpp"
 #include <stc/static_vector.hpp>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
 
 template <typename probe_type, size_t capacity>
 void verify_contains(stc::static_vector<probe_type, capacity>& v, std::initializer_list<typename probe_type::value_type> contents)
@@ -220,6 +224,78 @@ TEST_CASE("static_vector& operator=(static_vector&& other)", "[static_vector]")
     });
 }
 
+TEST_CASE("static_vector copies, moves and destroys each element once", "[static_vector]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    stc::static_vector<probe, 5> source{4, 3, 2};
+    stc::static_vector<probe, 5> numbers{9, 8};
+
+    probe::reset_counts();
+    stc::static_vector<probe, 5> copy(source);
+    auto counts = probe::last();
+    REQUIRE(counts.copco == 3);
+    REQUIRE(counts.destr == 0);
+
+    probe::reset_counts();
+    numbers = copy;
+    counts = probe::last();
+    REQUIRE(counts.copco == 3);
+    REQUIRE(counts.copas == 0);
+    REQUIRE(counts.destr == 2);
+
+    probe::reset_counts();
+    numbers = numbers;
+    counts = probe::last();
+    REQUIRE(counts.copies == 0);
+    REQUIRE(counts.destr == 0);
+    verify_contains(numbers, {4, 3, 2});
+
+    probe::reset_counts();
+    stc::static_vector<probe, 5> moved(std::move(copy));
+    counts = probe::last();
+    REQUIRE(counts.movco == 3);
+    REQUIRE(counts.copies == 0);
+    REQUIRE(counts.destr == 3);
+    verify_contains(moved, {4, 3, 2});
+    verify_contains(copy, {});
+}
+
+TEST_CASE("static_vector is trivially copyable when its elements are", "[static_vector]")
+{
+    struct pod
+    {
+        int64_t a;
+        double b;
+    };
+
+    static_assert(std::is_trivially_copyable_v<stc::static_vector<int, 16>>);
+    static_assert(std::is_trivially_copyable_v<stc::static_vector<pod, 4>>);
+    static_assert(std::is_trivially_destructible_v<stc::static_vector<pod, 4>>);
+    static_assert(!std::is_trivially_copyable_v<stc::static_vector<pr::probe_t<int>, 4>>);
+    static_assert(!std::is_trivially_copyable_v<stc::static_vector<std::string, 4>>);
+
+    stc::static_vector<pod, 4> source{{1, 1.5}, {2, 2.5}};
+    stc::static_vector<pod, 4> copy;
+    std::memcpy(static_cast<void*>(&copy), &source, sizeof(source));
+
+    REQUIRE(copy.size() == 2);
+    REQUIRE(copy[1].a == 2);
+    REQUIRE(copy[1].b == 2.5);
+
+    //the elements are left in place by a move
+    stc::static_vector<int, 16> numbers{1, 2, 3};
+    stc::static_vector<int, 16> moved(std::move(numbers));
+    REQUIRE(moved == (stc::static_vector<int, 16>{1, 2, 3}));
+
+    int raw[] = {7, 8, 9};
+    stc::static_vector<int, 16> from_pointers(std::begin(raw), std::end(raw));
+    REQUIRE(from_pointers == (stc::static_vector<int, 16>{7, 8, 9}));
+    from_pointers.assign(raw, raw + 1);
+    REQUIRE(from_pointers == (stc::static_vector<int, 16>{7}));
+}
+
 TEST_CASE("static_vector& operator=(std::initializer_list<value_type> data)", "[static_vector]")
 {
     using probe = pr::probe_t<int>;
@@ -597,6 +673,108 @@ TEST_CASE("iterator erase(const_iterator cerase_start, const_iterator cerase_end
     verify_contains(numbers, {2});
 }
 
+TEST_CASE("static_vector keeps its size in the smallest type that fits", "[static_vector]")
+{
+    static_assert(sizeof(stc::static_vector<uint8_t, 15>) == 16);
+    static_assert(sizeof(stc::static_vector<uint8_t, 255>) == 256);
+    static_assert(sizeof(stc::static_vector<uint16_t, 1000>) == 2002);
+    static_assert(sizeof(stc::static_vector<int32_t, 7>) == 32);
+    static_assert(sizeof(stc::static_vector<int64_t, 4>) == 40);
+    static_assert(sizeof(stc::static_vector<char, 70000>) == 70004);
+
+    stc::static_vector<uint8_t, 255> bytes(255, uint8_t{1});
+
+    REQUIRE(bytes.size() == 255);
+    REQUIRE(bytes.full());
+
+    bytes.erase(bytes.begin(), bytes.begin() + 200);
+    bytes.insert(bytes.begin(), 100, uint8_t{2});
+
+    REQUIRE(bytes.size() == 155);
+    REQUIRE(bytes.front() == 2);
+    REQUIRE(bytes.back() == 1);
+}
+
+TEST_CASE("static_vector shifts each element once on insert and erase", "[static_vector]")
+{
+    using probe = pr::probe_t<int>;
+    no_leak_verifier<probe> no_leak;
+
+    stc::static_vector<probe, 10> numbers{1, 2, 3, 4, 5};
+
+    probe::reset_counts();
+    numbers.insert(numbers.begin() + 1, probe{9});
+    auto counts = probe::last();
+    //the last element moves past the end, the others by assignment, and the value moves in
+    REQUIRE(counts.movco == 2);
+    REQUIRE(counts.movas == 3);
+    REQUIRE(counts.copies == 0);
+    verify_contains(numbers, {1, 9, 2, 3, 4, 5});
+
+    probe::reset_counts();
+    numbers.erase(numbers.begin() + 1, numbers.begin() + 3);
+    counts = probe::last();
+    REQUIRE(counts.movco == 0);
+    REQUIRE(counts.movas == 3);
+    REQUIRE(counts.destr == 2);
+    verify_contains(numbers, {1, 3, 4, 5});
+
+    probe::reset_counts();
+    numbers.insert(numbers.begin() + 3, 3, probe{7});
+    counts = probe::last();
+    REQUIRE(counts.movco == 1);
+    REQUIRE(counts.movas == 0);
+    verify_contains(numbers, {1, 3, 4, 7, 7, 7, 5});
+}
+
+namespace
+{
+    struct boxed
+    {
+        boxed(int value): number(std::make_unique<int>(value)) {}
+
+        std::unique_ptr<int> number;
+    };
+}
+
+namespace stc
+{
+    template <>
+    struct is_trivially_relocatable<boxed>: std::true_type {};
+}
+
+TEST_CASE("static_vector relocates elements declared trivially relocatable", "[static_vector]")
+{
+    static_assert(stc::is_trivially_relocatable_v<int>);
+    static_assert(!stc::is_trivially_relocatable_v<std::string>);
+
+    stc::static_vector<boxed, 8> boxes;
+    for(int i = 0; i < 5; ++i)
+        boxes.emplace_back(i);
+
+    boxes.insert(boxes.begin() + 2, boxed{10});
+    boxes.emplace(boxes.begin(), 11);
+    boxes.erase(boxes.begin() + 1, boxes.begin() + 3);
+    boxes.erase(boxes.end() - 1);
+
+    std::vector<int> contents;
+    for(const boxed& box : boxes)
+        contents.push_back(*box.number);
+
+    REQUIRE(contents == std::vector<int>{11, 10, 2, 3});
+}
+
+TEST_CASE("static_vector inserts elements of itself", "[static_vector]")
+{
+    stc::static_vector<std::string, 8> words{"a", "b", "c"};
+
+    words.insert(words.begin(), words[2]);
+    words.insert(words.begin() + 1, 2, words[1]);
+    words.emplace(words.begin(), words.back());
+
+    REQUIRE(words == (stc::static_vector<std::string, 8>{"c", "c", "a", "a", "a", "b", "c"}));
+}
+
 TEST_CASE("reference push_back(const value_type& new_entry)", "[static_vector]")
 {
     using probe = pr::probe_t<int>;
@@ -743,3 +921,64 @@ TEST_CASE("void resize(size_type new_size, const value_type& value)", "[static_v
 
     verify_contains(numbers, {5, 9, 9, 9, 9});
 }
+
+#if STC_CONSTEXPR_STORAGE
+namespace constexpr_checks
+{
+    constexpr stc::static_vector<int, 8> built()
+    {
+        stc::static_vector<int, 8> numbers{4, 2};
+        numbers.push_back(7);
+        numbers.emplace_back(1);
+        numbers.insert(numbers.begin() + 1, 5);
+        numbers.erase(numbers.begin());
+        return numbers;
+    }
+
+    constexpr bool sorts()
+    {
+        stc::static_vector<int, 8> numbers = built();
+        std::sort(numbers.begin(), numbers.end());
+        return numbers == stc::static_vector<int, 8>{1, 2, 5, 7};
+    }
+
+    constexpr bool copies_and_compares()
+    {
+        stc::static_vector<int, 8> numbers = built();
+        stc::static_vector<int, 8> copy = numbers;
+        copy.pop_back();
+
+        int sum = 0;
+        for(int number : numbers)
+            sum += number;
+
+        return copy < numbers && copy != numbers && numbers.back() == 1 && sum == 15;
+    }
+
+    struct point
+    {
+        int x = 0;
+        int y = 0;
+
+        constexpr point() = default;
+        constexpr point(int x_in, int y_in): x(x_in), y(y_in) {}
+        constexpr ~point() {}
+    };
+
+    constexpr int destroys_non_trivial()
+    {
+        stc::static_vector<point, 4> points;
+        points.emplace_back(1, 2);
+        points.emplace_back(3, 4);
+        points.resize(3);
+        points.erase(points.begin());
+        return points.size() == 2 ? points[0].x + points[0].y : -1;
+    }
+
+    static_assert(built().size() == 4);
+    static_assert(built()[0] == 5 && built()[3] == 1);
+    static_assert(sorts());
+    static_assert(copies_and_compares());
+    static_assert(destroys_non_trivial() == 7);
+}
+#endif